@@ -13,6 +13,7 @@
 #define TREE_HPP
 
 #include<bits/stdc++.h>
+#include "visitor.hpp"
 using namespace std;
 
 namespace data_structures {
@@ -85,24 +86,6 @@ private:
      */
     bool searchBST(TreeNode* node, int val);
 
-    /**
-     * @brief Inorder traversal (Left, Root, Right).
-     * @param node Current node.
-     */
-    void inorderTraversal(TreeNode* node);
-
-    /**
-     * @brief Preorder traversal (Root, Left, Right).
-     * @param node Current node.
-     */
-    void preorderTraversal(TreeNode* node);
-
-    /**
-     * @brief Postorder traversal (Left, Right, Root).
-     * @param node Current node.
-     */
-    void postorderTraversal(TreeNode* node);
-
     /**
      * @brief Calculates the height of the tree.
      * @param node Current node.
@@ -135,8 +118,6 @@ private:
 
     int findMax(TreeNode* node);
 
-    void levelOrderTraversal(TreeNode* node);
-
     int diameter(TreeNode* node, int& maxDiameter);
 
 public:
@@ -168,6 +149,48 @@ public:
      */
     void removeBST(int val);
 
+    /**
+     * @brief Calls visitor(value) on every node in inorder (Left, Root, Right).
+     *
+     * The visitor is a template parameter, so the call is inlined; it may return
+     * void or a VisitAction, where Stop ends the traversal (Skip acts as Continue).
+     * Iterative, so degenerate (list-shaped) trees cannot overflow the call stack.
+     * @param visitor Callable taking the node's value
+     * @return False if the visitor stopped the traversal, true otherwise
+     */
+    template <typename Visitor>
+    bool inorderVisit(Visitor&& visitor);
+
+    /**
+     * @brief Calls visitor(value) on every node in preorder (Root, Left, Right).
+     *
+     * Returning VisitAction::Skip leaves the node's subtrees unvisited; Stop ends
+     * the traversal.
+     * @param visitor Callable taking the node's value
+     * @return False if the visitor stopped the traversal, true otherwise
+     */
+    template <typename Visitor>
+    bool preorderVisit(Visitor&& visitor);
+
+    /**
+     * @brief Calls visitor(value) on every node in postorder (Left, Right, Root).
+     * @param visitor Callable taking the node's value; Stop ends the traversal
+     * @return False if the visitor stopped the traversal, true otherwise
+     */
+    template <typename Visitor>
+    bool postorderVisit(Visitor&& visitor);
+
+    /**
+     * @brief Calls visitor(value) on every node level by level, left to right.
+     *
+     * Returning VisitAction::Skip keeps the node's children out of the queue;
+     * Stop ends the traversal.
+     * @param visitor Callable taking the node's value
+     * @return False if the visitor stopped the traversal, true otherwise
+     */
+    template <typename Visitor>
+    bool levelOrderVisit(Visitor&& visitor);
+
     /**
      * @brief Displays tree nodes using inorder traversal.
      */
@@ -451,40 +474,89 @@ bool Tree::searchBST(TreeNode* node, int val) {
     return searchBST(node->right, val);
 }
 
-void Tree::inorder() {
-    inorderTraversal(root);
-    cout << endl;
+template <typename Visitor>
+bool Tree::inorderVisit(Visitor&& visitor) {
+    vector<TreeNode*> st;
+    TreeNode* curr = root;
+    while (curr || !st.empty()) {
+        while (curr) {
+            st.push_back(curr);
+            curr = curr->left;
+        }
+        curr = st.back(); st.pop_back();
+        if (visitStep([&] { return visitor(curr->data); }) == VisitAction::Stop) return false;
+        curr = curr->right;
+    }
+    return true;
 }
 
-void Tree::inorderTraversal(TreeNode* node) {
-    if (!node) return;
-    inorderTraversal(node->left);
-    cout << node->data << " ";
-    inorderTraversal(node->right);
+template <typename Visitor>
+bool Tree::preorderVisit(Visitor&& visitor) {
+    vector<TreeNode*> st;
+    if (root) st.push_back(root);
+    while (!st.empty()) {
+        TreeNode* curr = st.back(); st.pop_back();
+        VisitAction action = visitStep([&] { return visitor(curr->data); });
+        if (action == VisitAction::Stop) return false;
+        if (action == VisitAction::Skip) continue;
+        if (curr->right) st.push_back(curr->right);
+        if (curr->left) st.push_back(curr->left);
+    }
+    return true;
 }
 
-void Tree::preorder() {
-    preorderTraversal(root);
-    cout << endl;
+template <typename Visitor>
+bool Tree::postorderVisit(Visitor&& visitor) {
+    // A node is emitted once its right subtree (the last one walked) is done.
+    vector<TreeNode*> st;
+    TreeNode* curr = root;
+    TreeNode* lastVisited = nullptr;
+    while (curr || !st.empty()) {
+        while (curr) {
+            st.push_back(curr);
+            curr = curr->left;
+        }
+        TreeNode* top = st.back();
+        if (top->right && top->right != lastVisited) {
+            curr = top->right;
+            continue;
+        }
+        if (visitStep([&] { return visitor(top->data); }) == VisitAction::Stop) return false;
+        lastVisited = top;
+        st.pop_back();
+    }
+    return true;
 }
 
-void Tree::preorderTraversal(TreeNode* node) {
-    if (!node) return;
-    cout << node->data << " ";
-    preorderTraversal(node->left);
-    preorderTraversal(node->right);
+template <typename Visitor>
+bool Tree::levelOrderVisit(Visitor&& visitor) {
+    // The vector is the queue; head walks it instead of popping.
+    vector<TreeNode*> q;
+    if (root) q.push_back(root);
+    for (size_t head = 0; head < q.size(); ++head) {
+        TreeNode* curr = q[head];
+        VisitAction action = visitStep([&] { return visitor(curr->data); });
+        if (action == VisitAction::Stop) return false;
+        if (action == VisitAction::Skip) continue;
+        if (curr->left) q.push_back(curr->left);
+        if (curr->right) q.push_back(curr->right);
+    }
+    return true;
 }
 
-void Tree::postorder() {
-    postorderTraversal(root);
+void Tree::inorder() {
+    inorderVisit([](int val) { cout << val << " "; });
     cout << endl;
 }
 
-void Tree::postorderTraversal(TreeNode* node) {
-    if (!node) return;
-    postorderTraversal(node->left);
-    postorderTraversal(node->right);
-    cout << node->data << " ";
+void Tree::preorder() {
+    preorderVisit([](int val) { cout << val << " "; });
+    cout << endl;
+}
+
+void Tree::postorder() {
+    postorderVisit([](int val) { cout << val << " "; });
+    cout << endl;
 }
 
 int Tree::getHeight() {
@@ -534,21 +606,9 @@ int Tree::findMax(TreeNode* node) {
     return max({node->data, findMax(node->left), findMax(node->right)});
 }
 void Tree::levelOrder() {
-    levelOrderTraversal(root);
+    levelOrderVisit([](int val) { cout << val << " "; });
     cout << endl;
 }
-
-void Tree::levelOrderTraversal(TreeNode* node) {
-    if (!node) return;
-    queue<TreeNode*> q;
-    q.push(node);
-    while (!q.empty()) {
-        TreeNode* curr = q.front(); q.pop();
-        cout << curr->data << " ";
-        if (curr->left) q.push(curr->left);
-        if (curr->right) q.push(curr->right);
-    }
-}
 bool Tree::isComplete() {
     if (!root) return true;
     queue<TreeNode*> q;
@@ -0,0 +1,293 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef BIPARTITE_MATCHING_HPP
+#define BIPARTITE_MATCHING_HPP
+
+#include <vector>
+#include <utility>
+#include <climits>
+#include <stdexcept>
+#include "graph.hpp"
+
+namespace data_structures {
+
+/**
+ * @brief Maximum-cardinality bipartite matching by Hopcroft–Karp, O(E sqrt(V)).
+ *
+ * Runs on the two-coloring from Graph::bipartition(): side-0 vertices are the left
+ * side, and every edge (in either direction) joins a left and a right vertex. Both
+ * sides are renumbered compactly and the left-to-right adjacency is stored as CSR.
+ * A greedy pass seeds the matching. Each phase then runs one BFS from all free left
+ * vertices to layer the graph by shortest augmenting path length, and iterative DFSs
+ * with current-arc pointers augment along vertex-disjoint shortest paths.
+ *
+ * All buffers are members that keep their capacity, so calling compute() again
+ * (e.g. for an updated assignment graph) does not reallocate once they are large
+ * enough. The engine is not thread-safe.
+ */
+class BipartiteMatching {
+private:
+    std::vector<int> localOf;   ///< Compact index of each vertex within its side
+    std::vector<int> leftVertex;  ///< Graph vertex of each left index
+    std::vector<int> rightVertex; ///< Graph vertex of each right index
+    std::vector<int> arcStart;  ///< Size left + 1: first arc of each left vertex
+    std::vector<int> arcRight;  ///< Right index each arc leads to
+    std::vector<int> matchLeft; ///< Right partner of each left vertex, or -1
+    std::vector<int> matchRight; ///< Left partner of each right vertex, or -1
+    std::vector<int> layer;     ///< BFS layer of each left vertex (INT_MAX if unreached)
+    std::vector<int> queue;     ///< BFS queue of left vertices
+    std::vector<int> current;   ///< Next arc to try per left vertex in the current phase
+    std::vector<int> stack;     ///< Left vertices on the DFS path
+    std::vector<int> via;       ///< Right vertex taken from each stack entry
+    std::vector<int> mate;      ///< Graph vertex matched to each vertex, or -1
+    int matched = 0;            ///< Size of the last matching
+    int phaseCount = 0;         ///< BFS phases run by the last compute()
+
+    /**
+     * @brief Builds the compact left-to-right CSR from a graph and its coloring.
+     */
+    void build(const Graph& g, const Bipartition& parts);
+
+    /**
+     * @brief Layers left vertices by alternating BFS from the free ones.
+     * @return Length (in left layers) of the shortest augmenting paths, or INT_MAX if none
+     */
+    int buildLayers();
+
+    /**
+     * @brief Searches one shortest augmenting path from a free left vertex and applies it.
+     * @return True if the matching grew
+     */
+    bool augment(int root, int limit);
+
+public:
+    /**
+     * @brief Creates an engine with empty buffers.
+     */
+    BipartiteMatching() = default;
+
+    /**
+     * @brief Maximum matching of a bipartite graph; edge direction and weights are ignored.
+     * @return Number of matched pairs
+     * @throws std::invalid_argument if the graph is not bipartite
+     */
+    int compute(const Graph& g);
+
+    /**
+     * @brief Maximum matching using a coloring the caller already has.
+     * @param parts Result of g.bipartition() (side 0 is the left side)
+     * @return Number of matched pairs
+     * @throws std::invalid_argument if parts is not a bipartition of g's vertices
+     */
+    int compute(const Graph& g, const Bipartition& parts);
+
+    /**
+     * @brief Returns the partner of v in the last matching, or -1 if v is unmatched.
+     * @throws std::out_of_range if v is not a vertex of the last graph
+     */
+    int mateOf(int v) const;
+
+    /**
+     * @brief Returns the partner of every vertex (-1 if unmatched).
+     */
+    const std::vector<int>& mates() const;
+
+    /**
+     * @brief Returns the matched pairs as {side-0 vertex, side-1 vertex}, by side-0 vertex.
+     */
+    std::vector<std::pair<int, int>> matchedPairs() const;
+
+    /**
+     * @brief Returns the number of matched pairs.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of BFS phases the last compute() ran (at most about 2 sqrt(V)).
+     */
+    int phases() const;
+};
+
+// --- Method Implementations ---
+
+void BipartiteMatching::build(const Graph& g, const Bipartition& parts) {
+    const int V = g.numVertices();
+    leftVertex.clear();
+    rightVertex.clear();
+    localOf.resize(V);
+    for (int v = 0; v < V; ++v) {
+        std::vector<int>& sideList = parts.side[v] == 0 ? leftVertex : rightVertex;
+        localOf[v] = static_cast<int>(sideList.size());
+        sideList.push_back(v);
+    }
+
+    // Counting sort of edges by their left endpoint, whichever way they point.
+    const int L = static_cast<int>(leftVertex.size());
+    arcStart.assign(L + 1, 0);
+    for (int u = 0; u < V; ++u) {
+        for (const auto& edge : g.adjacentEdges(u)) {
+            if (parts.side[u] == parts.side[edge.first])
+                throw std::invalid_argument("Edge joins two vertices on the same side");
+            arcStart[localOf[parts.side[u] == 0 ? u : edge.first] + 1]++;
+        }
+    }
+    for (int i = 0; i < L; ++i) arcStart[i + 1] += arcStart[i];
+    arcRight.resize(arcStart[L]);
+    current.assign(arcStart.begin(), arcStart.end() - 1); // Next free slot per left vertex
+    for (int u = 0; u < V; ++u) {
+        for (const auto& edge : g.adjacentEdges(u)) {
+            int left = parts.side[u] == 0 ? u : edge.first;
+            int right = parts.side[u] == 0 ? edge.first : u;
+            arcRight[current[localOf[left]]++] = localOf[right];
+        }
+    }
+}
+
+int BipartiteMatching::buildLayers() {
+    const int L = static_cast<int>(leftVertex.size());
+    int tail = 0;
+    for (int u = 0; u < L; ++u) {
+        if (matchLeft[u] < 0) {
+            layer[u] = 0;
+            queue[tail++] = u;
+        } else {
+            layer[u] = INT_MAX;
+        }
+    }
+    // Stops growing layers once a free right vertex is seen: only shortest paths are used.
+    int limit = INT_MAX;
+    for (int head = 0; head < tail; ++head) {
+        int u = queue[head];
+        if (layer[u] + 1 > limit) break;
+        for (int a = arcStart[u]; a < arcStart[u + 1]; ++a) {
+            int w = matchRight[arcRight[a]];
+            if (w < 0) {
+                limit = layer[u] + 1;
+            } else if (layer[w] == INT_MAX) {
+                layer[w] = layer[u] + 1;
+                queue[tail++] = w;
+            }
+        }
+    }
+    return limit;
+}
+
+bool BipartiteMatching::augment(int root, int limit) {
+    int depth = 0;
+    stack[0] = root;
+    while (depth >= 0) {
+        int u = stack[depth];
+        if (current[u] == arcStart[u + 1]) {
+            layer[u] = INT_MAX; // No augmenting path through u in this phase
+            --depth;
+            continue;
+        }
+        int r = arcRight[current[u]++];
+        int w = matchRight[r];
+        if (w < 0 && layer[u] + 1 == limit) {
+            // Flip the path: every stack vertex takes the right vertex it left through.
+            via[depth] = r;
+            for (int i = 0; i <= depth; ++i) {
+                matchLeft[stack[i]] = via[i];
+                matchRight[via[i]] = stack[i];
+            }
+            return true;
+        }
+        if (w >= 0 && layer[w] == layer[u] + 1 && layer[w] < limit) {
+            via[depth] = r;
+            stack[++depth] = w;
+        }
+    }
+    return false;
+}
+
+int BipartiteMatching::compute(const Graph& g) {
+    Bipartition parts = g.bipartition();
+    if (!parts.bipartite) throw std::invalid_argument("Graph is not bipartite");
+    return compute(g, parts);
+}
+
+int BipartiteMatching::compute(const Graph& g, const Bipartition& parts) {
+    const int V = g.numVertices();
+    if (!parts.bipartite || static_cast<int>(parts.side.size()) != V)
+        throw std::invalid_argument("Bipartition does not match the graph");
+    build(g, parts);
+
+    const int L = static_cast<int>(leftVertex.size());
+    const int R = static_cast<int>(rightVertex.size());
+    matchLeft.assign(L, -1);
+    matchRight.assign(R, -1);
+    layer.resize(L);
+    queue.resize(L);
+    current.resize(L);
+    stack.resize(L);
+    via.resize(L);
+    matched = 0;
+    phaseCount = 0;
+
+    // Greedy start: usually matches most vertices, leaving few phases to run.
+    for (int u = 0; u < L; ++u) {
+        for (int a = arcStart[u]; a < arcStart[u + 1]; ++a) {
+            if (matchRight[arcRight[a]] < 0) {
+                matchLeft[u] = arcRight[a];
+                matchRight[arcRight[a]] = u;
+                matched++;
+                break;
+            }
+        }
+    }
+
+    for (int limit = buildLayers(); limit != INT_MAX; limit = buildLayers()) {
+        phaseCount++;
+        std::copy(arcStart.begin(), arcStart.end() - 1, current.begin());
+        for (int u = 0; u < L; ++u)
+            if (matchLeft[u] < 0 && augment(u, limit)) matched++;
+    }
+
+    mate.assign(V, -1);
+    for (int u = 0; u < L; ++u) {
+        if (matchLeft[u] >= 0) {
+            mate[leftVertex[u]] = rightVertex[matchLeft[u]];
+            mate[rightVertex[matchLeft[u]]] = leftVertex[u];
+        }
+    }
+    return matched;
+}
+
+int BipartiteMatching::mateOf(int v) const {
+    if (v < 0 || v >= static_cast<int>(mate.size())) throw std::out_of_range("Vertex out of range");
+    return mate[v];
+}
+
+const std::vector<int>& BipartiteMatching::mates() const {
+    return mate;
+}
+
+std::vector<std::pair<int, int>> BipartiteMatching::matchedPairs() const {
+    std::vector<std::pair<int, int>> pairs;
+    pairs.reserve(matched);
+    for (size_t u = 0; u < leftVertex.size(); ++u)
+        if (matchLeft[u] >= 0) pairs.emplace_back(leftVertex[u], rightVertex[matchLeft[u]]);
+    return pairs;
+}
+
+int BipartiteMatching::size() const {
+    return matched;
+}
+
+int BipartiteMatching::phases() const {
+    return phaseCount;
+}
+
+} // namespace data_structures
+
+#endif // BIPARTITE_MATCHING_HPP
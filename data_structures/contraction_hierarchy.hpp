@@ -0,0 +1,322 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef CONTRACTION_HIERARCHY_HPP
+#define CONTRACTION_HIERARCHY_HPP
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include "graph.hpp"
+#include "csr_graph.hpp"
+#include "shortest_path_engine.hpp"
+
+namespace data_structures {
+
+/**
+ * @brief Contraction hierarchy: a preprocessed index for fast s-t distance queries.
+ *
+ * Preprocessing contracts vertices one by one in order of importance (edge
+ * difference plus number of contracted neighbors, updated lazily). Contracting v
+ * adds a shortcut u -> x of weight w(u, v) + w(v, x) unless a bounded witness
+ * search finds a path from u to x that avoids v and is no longer. Each vertex's
+ * position in this order is its rank.
+ *
+ * A query runs a bidirectional Dijkstra that only follows edges to higher-ranked
+ * vertices: forward over the upward CSR, backward over the downward CSR (reversed
+ * arcs into lower-ranked vertices). Such searches settle a tiny fraction of the graph.
+ * Edge weights must be non-negative.
+ */
+class ContractionHierarchy {
+private:
+    /**
+     * @brief Arc in the graph being contracted.
+     */
+    struct Arc {
+        int to;     ///< Other endpoint
+        int weight; ///< Arc weight
+    };
+
+    /**
+     * @brief Witness searches give up after settling this many vertices (a shortcut is then added).
+     */
+    static const int WITNESS_SETTLE_LIMIT = 500;
+
+    int V;                              ///< Number of vertices
+    std::vector<int> rank;              ///< Contraction order position of each vertex
+    int shortcutCount;                  ///< Shortcuts added during preprocessing
+    std::unique_ptr<CSRGraph> upward;   ///< Arcs u -> x with rank[x] > rank[u]
+    std::unique_ptr<CSRGraph> downward; ///< For arcs z -> y with rank[z] > rank[y]: y -> z
+    ShortestPathEngine::Workspace forwardWs;  ///< Reused by query() for the forward search
+    ShortestPathEngine::Workspace backwardWs; ///< Reused by query() for the backward search
+
+    /**
+     * @brief Adds arc u -> x, or lowers its weight if it already exists.
+     */
+    static void addArc(std::vector<std::vector<Arc>>& out, std::vector<std::vector<Arc>>& in, int u, int x, int w);
+
+    /**
+     * @brief Contracts every vertex, filling rank and returning all arcs (original plus shortcuts).
+     */
+    std::vector<Edge> contractAll(const Graph& g);
+
+    /**
+     * @brief Resets the entries touched by the previous query in ws.
+     */
+    static void reset(ShortestPathEngine::Workspace& ws);
+
+public:
+    /**
+     * @brief Preprocesses a graph into a contraction hierarchy.
+     * @param g Graph with non-negative edge weights
+     */
+    explicit ContractionHierarchy(const Graph& g);
+
+    /**
+     * @brief Returns the shortest distance from s to t.
+     * @param s Source vertex
+     * @param t Target vertex
+     * @return Distance, INF if t is unreachable (same as Graph::dijkstra(s)[t])
+     */
+    int query(int s, int t);
+
+    /**
+     * @brief Returns the number of shortcut arcs added by preprocessing.
+     */
+    int numShortcuts() const;
+
+    /**
+     * @brief Returns the contraction rank of a vertex (0 = contracted first).
+     */
+    int getRank(int v) const;
+};
+
+// --- Method Implementations ---
+
+ContractionHierarchy::ContractionHierarchy(const Graph& g) : V(g.numVertices()), shortcutCount(0) {
+    std::vector<Edge> arcs = contractAll(g);
+
+    std::vector<Edge> up, down;
+    for (const Edge& e : arcs) {
+        if (rank[e.v] > rank[e.u]) up.push_back(e);
+        else down.push_back({e.v, e.u, e.weight});
+    }
+    upward.reset(new CSRGraph(V, up));
+    downward.reset(new CSRGraph(V, down));
+
+    forwardWs.dist.assign(V, INF);
+    backwardWs.dist.assign(V, INF);
+}
+
+void ContractionHierarchy::addArc(std::vector<std::vector<Arc>>& out, std::vector<std::vector<Arc>>& in, int u, int x, int w) {
+    if (u == x) return; // Self-loops never shorten a path
+    for (Arc& a : out[u]) {
+        if (a.to != x) continue;
+        if (w < a.weight) {
+            a.weight = w;
+            for (Arc& b : in[x]) {
+                if (b.to == u) { b.weight = w; break; }
+            }
+        }
+        return;
+    }
+    out[u].push_back({x, w});
+    in[x].push_back({u, w});
+}
+
+std::vector<Edge> ContractionHierarchy::contractAll(const Graph& g) {
+    std::vector<std::vector<Arc>> out(V), in(V);
+    for (int u = 0; u < V; ++u) {
+        for (const auto& edge : g.adjacentEdges(u))
+            addArc(out, in, u, edge.first, edge.second);
+    }
+
+    std::vector<char> contracted(V, 0);
+    std::vector<int> deletedNeighbors(V, 0);
+    rank.assign(V, 0);
+
+    // Witness-search scratch, reset sparsely through `touched`.
+    std::vector<int> dist(V, INF);
+    std::vector<int> touched;
+    using pii = std::pair<int, int>;
+    std::vector<pii> heap;
+    std::vector<Edge> pending; // Shortcuts found while contracting v
+
+    // Dijkstra from u among uncontracted vertices, never entering `skip`.
+    auto witnessSearch = [&](int u, int skip, int maxDist) {
+        for (int v : touched) dist[v] = INF;
+        touched.clear();
+        heap.clear();
+        dist[u] = 0;
+        touched.push_back(u);
+        heap.push_back({0, u});
+        int settled = 0;
+        while (!heap.empty() && settled < WITNESS_SETTLE_LIMIT) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<pii>());
+            pii top = heap.back();
+            heap.pop_back();
+            if (top.first > dist[top.second]) continue;
+            if (top.first > maxDist) break;
+            settled++;
+            for (const Arc& a : out[top.second]) {
+                if (contracted[a.to] || a.to == skip) continue;
+                int nd = top.first + a.weight;
+                if (nd < dist[a.to]) {
+                    if (dist[a.to] == INF) touched.push_back(a.to);
+                    dist[a.to] = nd;
+                    heap.push_back({nd, a.to});
+                    std::push_heap(heap.begin(), heap.end(), std::greater<pii>());
+                }
+            }
+        }
+    };
+
+    // Finds the shortcuts needed to contract v (into `pending`) and returns their count.
+    auto findShortcuts = [&](int v) {
+        pending.clear();
+        for (const Arc& inArc : in[v]) {
+            int u = inArc.to;
+            if (contracted[u]) continue;
+            int maxDist = -1;
+            for (const Arc& outArc : out[v]) {
+                if (!contracted[outArc.to] && outArc.to != u)
+                    maxDist = std::max(maxDist, inArc.weight + outArc.weight);
+            }
+            if (maxDist < 0) continue;
+
+            witnessSearch(u, v, maxDist);
+            for (const Arc& outArc : out[v]) {
+                int x = outArc.to;
+                if (contracted[x] || x == u) continue;
+                int viaV = inArc.weight + outArc.weight;
+                if (dist[x] > viaV) pending.push_back({u, x, viaV});
+            }
+        }
+        return static_cast<int>(pending.size());
+    };
+
+    auto liveDegree = [&](int v) {
+        int degree = 0;
+        for (const Arc& a : in[v]) degree += !contracted[a.to];
+        for (const Arc& a : out[v]) degree += !contracted[a.to];
+        return degree;
+    };
+
+    auto priority = [&](int v) {
+        return findShortcuts(v) - liveDegree(v) + deletedNeighbors[v];
+    };
+
+    std::priority_queue<pii, std::vector<pii>, std::greater<pii>> order; // {priority, vertex}
+    for (int v = 0; v < V; ++v)
+        order.push({priority(v), v});
+
+    int nextRank = 0;
+    while (!order.empty()) {
+        int v = order.top().second;
+        order.pop();
+        if (contracted[v]) continue;
+
+        // Lazy update: re-evaluate, and postpone v if it is no longer the best choice.
+        int current = priority(v);
+        if (!order.empty() && current > order.top().first) {
+            order.push({current, v});
+            continue;
+        }
+
+        findShortcuts(v);
+        for (const auto& shortcut : pending) {
+            addArc(out, in, shortcut.u, shortcut.v, shortcut.weight);
+            shortcutCount++;
+        }
+        contracted[v] = 1;
+        rank[v] = nextRank++;
+        for (const Arc& a : in[v]) deletedNeighbors[a.to]++;
+        for (const Arc& a : out[v]) deletedNeighbors[a.to]++;
+    }
+
+    std::vector<Edge> arcs;
+    for (int u = 0; u < V; ++u) {
+        for (const Arc& a : out[u])
+            arcs.push_back({u, a.to, a.weight});
+    }
+    return arcs;
+}
+
+void ContractionHierarchy::reset(ShortestPathEngine::Workspace& ws) {
+    for (int v : ws.touched) ws.dist[v] = INF;
+    ws.touched.clear();
+    ws.heap.clear();
+}
+
+int ContractionHierarchy::query(int s, int t) {
+    if (s < 0 || s >= V || t < 0 || t >= V) return INF;
+    if (s == t) return 0;
+
+    using pii = std::pair<int, int>;
+    auto cmp = std::greater<pii>();
+    reset(forwardWs);
+    reset(backwardWs);
+    forwardWs.dist[s] = 0;
+    forwardWs.touched.push_back(s);
+    forwardWs.heap.push_back({0, s});
+    backwardWs.dist[t] = 0;
+    backwardWs.touched.push_back(t);
+    backwardWs.heap.push_back({0, t});
+
+    int best = INF;
+    while (true) {
+        // A side is finished once its smallest key cannot beat the best meeting distance.
+        bool forwardOpen = !forwardWs.heap.empty() && forwardWs.heap.front().first < best;
+        bool backwardOpen = !backwardWs.heap.empty() && backwardWs.heap.front().first < best;
+        if (!forwardOpen && !backwardOpen) break;
+
+        bool forwardSide = forwardOpen &&
+            (!backwardOpen || forwardWs.heap.front().first <= backwardWs.heap.front().first);
+        ShortestPathEngine::Workspace& ws = forwardSide ? forwardWs : backwardWs;
+        const ShortestPathEngine::Workspace& other = forwardSide ? backwardWs : forwardWs;
+        const CSRGraph& g = forwardSide ? *upward : *downward;
+
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), cmp);
+        int d = ws.heap.back().first;
+        int u = ws.heap.back().second;
+        ws.heap.pop_back();
+        if (d > ws.dist[u]) continue;
+        if (other.dist[u] != INF) best = std::min(best, d + other.dist[u]);
+
+        for (int e = g.edgeBegin(u); e < g.edgeEnd(u); ++e) {
+            int v = g.edgeTarget(e);
+            int nd = d + g.edgeWeight(e);
+            if (nd < ws.dist[v]) {
+                if (ws.dist[v] == INF) ws.touched.push_back(v);
+                ws.dist[v] = nd;
+                ws.heap.push_back({nd, v});
+                std::push_heap(ws.heap.begin(), ws.heap.end(), cmp);
+                if (other.dist[v] != INF) best = std::min(best, nd + other.dist[v]);
+            }
+        }
+    }
+    return best;
+}
+
+int ContractionHierarchy::numShortcuts() const {
+    return shortcutCount;
+}
+
+int ContractionHierarchy::getRank(int v) const {
+    return rank[v];
+}
+
+} // namespace data_structures
+
+#endif // CONTRACTION_HIERARCHY_HPP
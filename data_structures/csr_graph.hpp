@@ -0,0 +1,1125 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <limits>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+#include "graph.hpp"
+#include "thread_pool.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DS_HAVE_MMAP 1
+#endif
+
+namespace data_structures {
+
+/**
+ * @brief Fixed-size bitmap whose bits can be set concurrently by many threads.
+ */
+class AtomicBitmap {
+private:
+    std::vector<std::atomic<uint64_t>> words; ///< 64 bits per word
+
+public:
+    /**
+     * @brief Creates a bitmap of n cleared bits.
+     */
+    explicit AtomicBitmap(int n);
+
+    /**
+     * @brief Checks whether bit i is set.
+     */
+    bool test(int i) const;
+
+    /**
+     * @brief Sets bit i.
+     */
+    void set(int i);
+
+    /**
+     * @brief Atomically sets bit i.
+     * @return True if this call changed the bit from 0 to 1
+     */
+    bool trySet(int i);
+
+    /**
+     * @brief Clears every bit.
+     */
+    void clear();
+};
+
+/**
+ * @brief Result of a breadth-first search: hop distance and BFS-tree parent per vertex.
+ */
+struct BFSResult {
+    std::vector<int> dist;   ///< Hops from the source, -1 if unreachable
+    std::vector<int> parent; ///< BFS-tree parent, the source is its own parent, -1 if unreachable
+};
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where the platform supports it.
+ *
+ * Without mmap the file is read into memory instead. Copies share the mapping,
+ * which is released when the last copy (or share() handle) goes away.
+ */
+class MappedFile {
+private:
+    std::shared_ptr<const void> bytes; ///< Start of the file contents (null if empty)
+    size_t length;                     ///< File size in bytes
+
+public:
+    /**
+     * @brief Maps a file.
+     * @param path File to open
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief Returns the first byte of the file.
+     */
+    const char* data() const;
+
+    /**
+     * @brief Returns the file size in bytes.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns an owning handle that keeps the mapping alive.
+     */
+    std::shared_ptr<const void> share() const;
+};
+
+/**
+ * @brief Header of the binary CSR file format (version 1).
+ *
+ * Layout: this 40-byte header, then int32 offsets[V + 1], int32 targets[E], and,
+ * if FLAG_WEIGHTED is set, int32 weights[E]. Integers are in the writer's native
+ * byte order, recorded in byteOrder so a mismatched reader fails cleanly instead
+ * of misreading. The arrays have the same layout as CSRGraph's, so a mapped file
+ * is used in place.
+ */
+struct CSRFileHeader {
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr uint32_t FLAG_WEIGHTED = 1;        ///< weights[] follows targets[]
+    static constexpr uint32_t FLAG_NEGATIVE_WEIGHT = 2; ///< Some weight is negative
+
+    char magic[8];      ///< "DSCSRGR" plus a terminating zero
+    uint32_t version;   ///< Format version (VERSION)
+    uint32_t byteOrder; ///< BYTE_ORDER_MARK as written by the producer
+    int64_t vertices;   ///< V
+    int64_t edges;      ///< E
+    uint32_t flags;     ///< FLAG_* bits
+    int32_t maxWeight;  ///< Largest weight (1 for unweighted files, 0 if E = 0)
+};
+static_assert(sizeof(CSRFileHeader) == 40, "CSRFileHeader must have no padding");
+
+/**
+ * @brief Immutable weighted directed graph in Compressed Sparse Row form.
+ *
+ * The out-edges of vertex u are stored contiguously in
+ * targets[offsets[u] .. offsets[u + 1]) with matching weights, so memory is
+ * O(V + E) and neighbor scans are sequential. Build once from a Graph or an
+ * edge list, then run the read-only algorithms below.
+ *
+ * The arrays are either owned by the object or live in a binary file opened with
+ * openBinary(), which memory-maps it read-only: pages load on first touch, and
+ * processes opening the same file share the page cache. Copies of a file-backed
+ * graph share the mapping. By default opening validates the arrays in one O(V + E)
+ * pass (offsets, targets, weight summary), so a corrupt file is rejected instead of
+ * causing out-of-bounds reads later. openBinary(path, false) skips that pass and
+ * opens in O(1); use it only for trusted files, since the algorithms then rely on
+ * the file being well formed.
+ */
+class CSRGraph {
+private:
+    int V;                              ///< Number of vertices
+    const int* offsets;                 ///< Size V + 1: start of each vertex's edge range
+    const int* targets;                 ///< Size E: destination of each edge
+    const int* weights;                 ///< Size E: weight of each edge, null if every weight is 1
+    std::vector<int> ownedOffsets;      ///< Backing storage of offsets unless file-backed
+    std::vector<int> ownedTargets;      ///< Backing storage of targets unless file-backed
+    std::vector<int> ownedWeights;      ///< Backing storage of weights unless file-backed
+    std::shared_ptr<const void> file;   ///< Mapped (or, without mmap, read) file; null if owned
+    int maxWeight;                      ///< Largest edge weight (0 if no edges)
+    bool hasNegativeWeight;             ///< True if any edge weight is negative
+
+    /**
+     * @brief Creates an empty graph, to be filled by openBinary().
+     */
+    CSRGraph();
+
+    /**
+     * @brief Points offsets, targets and weights at the owned vectors.
+     */
+    void bindOwned();
+
+    /**
+     * @brief Computes maxWeight and hasNegativeWeight from the weights array.
+     */
+    void scanWeights();
+
+    /**
+     * @brief Checks a freshly mapped file: offsets never decrease and stay within
+     *        [0, E], every target is a vertex, and maxWeight / hasNegativeWeight
+     *        (taken from the header) match the weights.
+     * @throws std::runtime_error naming the first inconsistency found
+     */
+    void validate(const std::string& path) const;
+
+    /**
+     * @brief Writes a CSRFileHeader for the given sizes to out.
+     */
+    static void writeHeader(std::ofstream& out, int vertices, int64_t edges, bool weighted,
+                            int maxW, bool negative);
+
+    /**
+     * @brief Closes a fully written temporary file and renames it over path.
+     *
+     * Replacing by rename leaves readers that still map the old file unaffected.
+     */
+    static void commitFile(std::ofstream& out, const std::string& partial, const std::string& path);
+
+public:
+    /**
+     * @brief Builds a CSR graph from an edge list using a counting sort by source.
+     * @param vertices Number of vertices
+     * @param edges Directed edges; out-of-range edges are ignored
+     */
+    CSRGraph(int vertices, const std::vector<Edge>& edges);
+
+    /**
+     * @brief Builds a CSR graph from a large edge list with a parallel counting sort.
+     *
+     * The edge list is split into blocks that count degrees into private histograms
+     * and then scatter into disjoint slots, so no atomics are needed and the result
+     * is identical to the sequential constructor (input order within each vertex).
+     * @param vertices Number of vertices
+     * @param edges Directed edges; out-of-range edges are ignored
+     * @param pool Worker threads
+     */
+    CSRGraph(int vertices, const std::vector<Edge>& edges, ThreadPool& pool);
+
+    /**
+     * @brief Builds a CSR graph from the adjacency list of a Graph in one pass.
+     * @param g Source graph (edge order per vertex is preserved)
+     */
+    explicit CSRGraph(const Graph& g);
+
+    /**
+     * @brief Copies a graph; owned arrays are duplicated, a file mapping is shared.
+     */
+    CSRGraph(const CSRGraph& other);
+
+    /**
+     * @brief Copy-assigns a graph; owned arrays are duplicated, a file mapping is shared.
+     */
+    CSRGraph& operator=(const CSRGraph& other);
+
+    CSRGraph(CSRGraph&& other) = default;
+    CSRGraph& operator=(CSRGraph&& other) = default;
+
+    /**
+     * @brief Opens a binary CSR file as a read-only graph without copying its arrays.
+     * @param path File written by saveBinary()
+     * @param validateArrays Scan the arrays once (O(V + E)) and reject inconsistent
+     *        files; pass false only for trusted files to open in O(1)
+     * @return Graph whose arrays point into the mapped file
+     * @throws std::runtime_error if the file cannot be opened or is not a valid version-1 file
+     */
+    static CSRGraph openBinary(const std::string& path, bool validateArrays = true);
+
+    /**
+     * @brief Writes this graph in the binary CSR format.
+     * @param path Output file, replaced atomically (safe even if it is the file this graph maps)
+     * @param withWeights Store the weights array; if false every weight reads back as 1
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void saveBinary(const std::string& path, bool withWeights = true) const;
+
+    /**
+     * @brief Writes a Graph in the binary CSR format, streaming its adjacency lists.
+     * @param g Graph to write
+     * @param path Output file, replaced atomically
+     * @param withWeights Store the weights array; if false every weight reads back as 1
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void saveBinary(const Graph& g, const std::string& path, bool withWeights = true);
+
+    /**
+     * @brief Checks whether the arrays live in a file opened with openBinary().
+     */
+    bool isFileBacked() const;
+
+    /**
+     * @brief Returns the number of vertices.
+     */
+    int numVertices() const;
+
+    /**
+     * @brief Returns the number of edges.
+     */
+    int numEdges() const;
+
+    /**
+     * @brief Returns the out-degree of a vertex.
+     * @param u Vertex
+     */
+    int outDegree(int u) const;
+
+    /**
+     * @brief Index of the first out-edge of u.
+     */
+    int edgeBegin(int u) const;
+
+    /**
+     * @brief One past the index of the last out-edge of u.
+     */
+    int edgeEnd(int u) const;
+
+    /**
+     * @brief Destination vertex of edge e.
+     */
+    int edgeTarget(int e) const;
+
+    /**
+     * @brief Weight of edge e.
+     */
+    int edgeWeight(int e) const;
+
+    /**
+     * @brief Returns the graph with every edge reversed.
+     */
+    CSRGraph getTranspose() const;
+
+    /**
+     * @brief Breadth-First Search from a given vertex (ignores weights).
+     * @param start Starting vertex
+     * @return Vertices in the order they were visited
+     */
+    std::vector<int> BFS(int start) const;
+
+    /**
+     * @brief Multi-threaded, level-synchronous, direction-optimizing BFS.
+     *
+     * Each level is either a top-down step (frontier vertices claim unvisited
+     * neighbors through an atomic bitmap) or a bottom-up step (every unvisited
+     * vertex scans its in-edges for a frontier parent), switching with Beamer's
+     * heuristic. Bottom-up steps read in-edges from `incoming`; when it is null
+     * the transpose is built the first time a bottom-up step is taken.
+     * @param start Source vertex
+     * @param pool Worker threads to split each level across
+     * @param incoming Optional transpose of this graph (pass *this for undirected graphs)
+     * @return Distance and parent arrays
+     */
+    BFSResult parallelBFS(int start, ThreadPool& pool = ThreadPool::defaultPool(),
+                          const CSRGraph* incoming = nullptr) const;
+
+    /**
+     * @brief Computes shortest path from start using Dijkstra's algorithm.
+     * @param start Source vertex
+     * @return Vector of shortest distances (INF if unreachable)
+     */
+    std::vector<int> dijkstra(int start) const;
+
+    /**
+     * @brief Parallel delta-stepping single-source shortest paths.
+     *
+     * Vertices are kept in buckets of width delta. The lowest bucket is settled in
+     * phases: its light edges (weight <= delta) are relaxed in parallel until the
+     * bucket stops refilling, then the heavy edges of everything it settled are
+     * relaxed in parallel. Buckets are circular, so memory does not grow with the
+     * largest distance. Falls back to dijkstra() if any weight is negative.
+     * @param start Source vertex
+     * @param delta Bucket width; 0 picks maxWeight / average out-degree
+     * @param pool Worker threads
+     * @return Vector of shortest distances, identical to dijkstra(start)
+     */
+    std::vector<int> deltaStepping(int start, int delta = 0, ThreadPool& pool = ThreadPool::defaultPool()) const;
+
+    /**
+     * @brief Performs Topological Sort using Kahn's algorithm (only valid for DAGs).
+     * @return A vector with topological order or empty if cycle detected.
+     */
+    std::vector<int> topologicalSort() const;
+
+    /**
+     * @brief Finds Strongly Connected Components with an iterative Kosaraju pass.
+     * @return Vector of components (each as vector<int>)
+     */
+    std::vector<std::vector<int>> getSCCs() const;
+
+    /**
+     * @brief Computes MST total weight using Prim's algorithm starting at vertex 0.
+     * @return Total weight of MST
+     */
+    int primMST() const;
+};
+
+// --- Method Implementations ---
+
+MappedFile::MappedFile(const std::string& path) : length(0) {
+#ifdef DS_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open file: " + path);
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot stat file: " + path);
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    if (size > 0) {
+        void* base = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Cannot map file: " + path);
+        }
+        bytes = std::shared_ptr<const void>(base, [size](const void* p) { ::munmap(const_cast<void*>(p), size); });
+    }
+    ::close(fd); // The mapping stays valid after the descriptor is closed
+    length = size;
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) throw std::runtime_error("Cannot open file: " + path);
+    length = static_cast<size_t>(in.tellg());
+    std::shared_ptr<std::vector<char>> buffer = std::make_shared<std::vector<char>>(length);
+    in.seekg(0);
+    in.read(buffer->data(), static_cast<std::streamsize>(length));
+    if (!in) throw std::runtime_error("Cannot read file: " + path);
+    bytes = std::shared_ptr<const void>(buffer, buffer->data());
+#endif
+}
+
+const char* MappedFile::data() const {
+    return static_cast<const char*>(bytes.get());
+}
+
+size_t MappedFile::size() const {
+    return length;
+}
+
+std::shared_ptr<const void> MappedFile::share() const {
+    return bytes;
+}
+
+AtomicBitmap::AtomicBitmap(int n) : words((n + 63) / 64) {
+    clear();
+}
+
+bool AtomicBitmap::test(int i) const {
+    return (words[i >> 6].load(std::memory_order_relaxed) >> (i & 63)) & 1ULL;
+}
+
+void AtomicBitmap::set(int i) {
+    words[i >> 6].fetch_or(1ULL << (i & 63), std::memory_order_relaxed);
+}
+
+bool AtomicBitmap::trySet(int i) {
+    uint64_t bit = 1ULL << (i & 63);
+    if (words[i >> 6].load(std::memory_order_relaxed) & bit) return false;
+    return !(words[i >> 6].fetch_or(bit, std::memory_order_relaxed) & bit);
+}
+
+void AtomicBitmap::clear() {
+    for (auto& w : words)
+        w.store(0, std::memory_order_relaxed);
+}
+
+CSRGraph::CSRGraph() : V(0), offsets(nullptr), targets(nullptr), weights(nullptr),
+    maxWeight(0), hasNegativeWeight(false) {}
+
+CSRGraph::CSRGraph(int vertices, const std::vector<Edge>& edges) : V(vertices) {
+    ownedOffsets.assign(V + 1, 0);
+    for (const Edge& e : edges) {
+        if (e.u < 0 || e.u >= V || e.v < 0 || e.v >= V) continue;
+        ownedOffsets[e.u + 1]++;
+    }
+    for (int u = 0; u < V; ++u)
+        ownedOffsets[u + 1] += ownedOffsets[u];
+
+    ownedTargets.resize(ownedOffsets[V]);
+    ownedWeights.resize(ownedOffsets[V]);
+    std::vector<int> cursor(ownedOffsets.begin(), ownedOffsets.end() - 1);
+    for (const Edge& e : edges) {
+        if (e.u < 0 || e.u >= V || e.v < 0 || e.v >= V) continue;
+        int pos = cursor[e.u]++;
+        ownedTargets[pos] = e.v;
+        ownedWeights[pos] = e.weight;
+    }
+    bindOwned();
+    scanWeights();
+}
+
+CSRGraph::CSRGraph(int vertices, const std::vector<Edge>& edges, ThreadPool& pool) : V(vertices) {
+    const int64_t m = static_cast<int64_t>(edges.size());
+    auto valid = [&](const Edge& e) { return e.u >= 0 && e.u < V && e.v >= 0 && e.v < V; };
+
+    // One private degree histogram per block of edges; capping blocks at E / V keeps
+    // the histograms no larger than the edge list itself.
+    int blocks = static_cast<int>(std::max<int64_t>(1, std::min<int64_t>(pool.size(), V > 0 ? m / V : 1)));
+    std::vector<int64_t> bounds(blocks + 1);
+    for (int b = 0; b <= blocks; ++b)
+        bounds[b] = m * b / blocks;
+    std::vector<std::vector<int>> cursor(blocks, std::vector<int>(V, 0));
+
+    pool.parallelFor(0, blocks, [&](int64_t lo, int64_t hi, int) {
+        for (int64_t b = lo; b < hi; ++b) {
+            std::vector<int>& count = cursor[b];
+            for (int64_t i = bounds[b]; i < bounds[b + 1]; ++i) {
+                if (valid(edges[i])) count[edges[i].u]++;
+            }
+        }
+    }, 1);
+
+    ownedOffsets.assign(V + 1, 0);
+    pool.parallelFor(0, V, [&](int64_t lo, int64_t hi, int) {
+        for (int64_t u = lo; u < hi; ++u) {
+            for (int b = 0; b < blocks; ++b)
+                ownedOffsets[u + 1] += cursor[b][u];
+        }
+    }, 1 << 14);
+    for (int u = 0; u < V; ++u)
+        ownedOffsets[u + 1] += ownedOffsets[u];
+
+    // Block b writes vertex u's edges after those of blocks 0 .. b-1, preserving input order.
+    pool.parallelFor(0, V, [&](int64_t lo, int64_t hi, int) {
+        for (int64_t u = lo; u < hi; ++u) {
+            int running = ownedOffsets[u];
+            for (int b = 0; b < blocks; ++b) {
+                int count = cursor[b][u];
+                cursor[b][u] = running;
+                running += count;
+            }
+        }
+    }, 1 << 14);
+
+    ownedTargets.resize(ownedOffsets[V]);
+    ownedWeights.resize(ownedOffsets[V]);
+    pool.parallelFor(0, blocks, [&](int64_t lo, int64_t hi, int) {
+        for (int64_t b = lo; b < hi; ++b) {
+            std::vector<int>& next = cursor[b];
+            for (int64_t i = bounds[b]; i < bounds[b + 1]; ++i) {
+                if (!valid(edges[i])) continue;
+                int pos = next[edges[i].u]++;
+                ownedTargets[pos] = edges[i].v;
+                ownedWeights[pos] = edges[i].weight;
+            }
+        }
+    }, 1);
+
+    bindOwned();
+    scanWeights();
+}
+
+CSRGraph::CSRGraph(const Graph& g) : V(g.numVertices()) {
+    ownedOffsets.assign(V + 1, 0);
+    for (int u = 0; u < V; ++u)
+        ownedOffsets[u + 1] = ownedOffsets[u] + static_cast<int>(g.adjacentEdges(u).size());
+
+    ownedTargets.resize(ownedOffsets[V]);
+    ownedWeights.resize(ownedOffsets[V]);
+    for (int u = 0; u < V; ++u) {
+        int pos = ownedOffsets[u];
+        for (const auto& edge : g.adjacentEdges(u)) {
+            ownedTargets[pos] = edge.first;
+            ownedWeights[pos] = edge.second;
+            ++pos;
+        }
+    }
+    bindOwned();
+    scanWeights();
+}
+
+CSRGraph::CSRGraph(const CSRGraph& other)
+    : V(other.V), offsets(other.offsets), targets(other.targets), weights(other.weights),
+      ownedOffsets(other.ownedOffsets), ownedTargets(other.ownedTargets), ownedWeights(other.ownedWeights),
+      file(other.file), maxWeight(other.maxWeight), hasNegativeWeight(other.hasNegativeWeight) {
+    if (!file) bindOwned();
+}
+
+CSRGraph& CSRGraph::operator=(const CSRGraph& other) {
+    if (this == &other) return *this;
+    V = other.V;
+    offsets = other.offsets;
+    targets = other.targets;
+    weights = other.weights;
+    ownedOffsets = other.ownedOffsets;
+    ownedTargets = other.ownedTargets;
+    ownedWeights = other.ownedWeights;
+    file = other.file;
+    maxWeight = other.maxWeight;
+    hasNegativeWeight = other.hasNegativeWeight;
+    if (!file) bindOwned();
+    return *this;
+}
+
+void CSRGraph::bindOwned() {
+    offsets = ownedOffsets.data();
+    targets = ownedTargets.data();
+    weights = ownedWeights.data();
+}
+
+void CSRGraph::scanWeights() {
+    maxWeight = 0;
+    hasNegativeWeight = false;
+    for (int e = 0; e < numEdges(); ++e) {
+        maxWeight = std::max(maxWeight, edgeWeight(e));
+        if (edgeWeight(e) < 0) hasNegativeWeight = true;
+    }
+}
+
+void CSRGraph::writeHeader(std::ofstream& out, int vertices, int64_t edges, bool weighted,
+                           int maxW, bool negative) {
+    CSRFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "DSCSRGR", 8);
+    header.version = CSRFileHeader::VERSION;
+    header.byteOrder = CSRFileHeader::BYTE_ORDER_MARK;
+    header.vertices = vertices;
+    header.edges = edges;
+    header.flags = (weighted ? CSRFileHeader::FLAG_WEIGHTED : 0) |
+                   (weighted && negative ? CSRFileHeader::FLAG_NEGATIVE_WEIGHT : 0);
+    header.maxWeight = weighted ? maxW : (edges > 0 ? 1 : 0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+void CSRGraph::commitFile(std::ofstream& out, const std::string& partial, const std::string& path) {
+    out.close();
+    if (!out) {
+        std::remove(partial.c_str());
+        throw std::runtime_error("Cannot write graph file: " + partial);
+    }
+    if (std::rename(partial.c_str(), path.c_str()) != 0) {
+        std::remove(partial.c_str());
+        throw std::runtime_error("Cannot replace graph file: " + path);
+    }
+}
+
+CSRGraph CSRGraph::openBinary(const std::string& path, bool validateArrays) {
+    CSRGraph g;
+    MappedFile mapped(path);
+    g.file = mapped.share();
+    const char* bytes = mapped.data();
+    size_t size = mapped.size();
+    CSRFileHeader header;
+    if (size < sizeof(header)) throw std::runtime_error("Truncated graph file: " + path);
+    std::memcpy(&header, bytes, sizeof(header));
+    if (std::memcmp(header.magic, "DSCSRGR", 8) != 0)
+        throw std::runtime_error("Not a binary CSR graph file: " + path);
+    if (header.byteOrder != CSRFileHeader::BYTE_ORDER_MARK)
+        throw std::runtime_error("Graph file was written with a different byte order: " + path);
+    if (header.version != CSRFileHeader::VERSION)
+        throw std::runtime_error("Unsupported graph file version " + std::to_string(header.version) + ": " + path);
+    if (header.vertices < 0 || header.vertices >= INF || header.edges < 0 || header.edges > INF)
+        throw std::runtime_error("Corrupt graph file header: " + path);
+
+    bool weighted = (header.flags & CSRFileHeader::FLAG_WEIGHTED) != 0;
+    uint64_t arrays = static_cast<uint64_t>(header.vertices + 1) + static_cast<uint64_t>(header.edges) * (weighted ? 2 : 1);
+    if (size != sizeof(header) + arrays * sizeof(int))
+        throw std::runtime_error("Graph file size does not match its header: " + path);
+
+    g.V = static_cast<int>(header.vertices);
+    g.offsets = reinterpret_cast<const int*>(bytes + sizeof(header));
+    g.targets = g.offsets + g.V + 1;
+    g.weights = weighted ? g.targets + header.edges : nullptr;
+    if (g.offsets[0] != 0 || g.offsets[g.V] != header.edges)
+        throw std::runtime_error("Corrupt graph file offsets: " + path);
+    // Taken from the header; validate() checks them against the weights.
+    g.maxWeight = header.maxWeight;
+    g.hasNegativeWeight = (header.flags & CSRFileHeader::FLAG_NEGATIVE_WEIGHT) != 0;
+    if (validateArrays) g.validate(path);
+    return g;
+}
+
+void CSRGraph::validate(const std::string& path) const {
+    const int edges = numEdges();
+    for (int u = 0; u < V; ++u) {
+        if (offsets[u] > offsets[u + 1] || offsets[u + 1] > edges)
+            throw std::runtime_error("Corrupt graph file offsets at vertex " + std::to_string(u) + ": " + path);
+    }
+    for (int e = 0; e < edges; ++e) {
+        if (targets[e] < 0 || targets[e] >= V)
+            throw std::runtime_error("Corrupt graph file target at edge " + std::to_string(e) + ": " + path);
+    }
+
+    // Unweighted files read every weight as 1, so the same comparison covers them.
+    int scannedMax = 0;
+    bool scannedNegative = false;
+    for (int e = 0; e < edges; ++e) {
+        scannedMax = std::max(scannedMax, edgeWeight(e));
+        if (edgeWeight(e) < 0) scannedNegative = true;
+    }
+    if (scannedMax != maxWeight || scannedNegative != hasNegativeWeight)
+        throw std::runtime_error("Graph file weight summary does not match its weights: " + path);
+}
+
+void CSRGraph::saveBinary(const std::string& path, bool withWeights) const {
+    const std::string partial = path + ".partial";
+    std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("Cannot create graph file: " + partial);
+    writeHeader(out, V, numEdges(), withWeights, maxWeight, hasNegativeWeight);
+    out.write(reinterpret_cast<const char*>(offsets), static_cast<std::streamsize>(V + 1) * sizeof(int));
+    out.write(reinterpret_cast<const char*>(targets), static_cast<std::streamsize>(numEdges()) * sizeof(int));
+    if (withWeights) {
+        if (weights != nullptr) {
+            out.write(reinterpret_cast<const char*>(weights), static_cast<std::streamsize>(numEdges()) * sizeof(int));
+        } else {
+            std::vector<int> ones(numEdges(), 1);
+            out.write(reinterpret_cast<const char*>(ones.data()), static_cast<std::streamsize>(ones.size()) * sizeof(int));
+        }
+    }
+    commitFile(out, partial, path);
+}
+
+void CSRGraph::saveBinary(const Graph& g, const std::string& path, bool withWeights) {
+    int n = g.numVertices();
+    std::vector<int> offsetArray(n + 1, 0);
+    int maxW = 0;
+    bool negative = false;
+    for (int u = 0; u < n; ++u) {
+        offsetArray[u + 1] = offsetArray[u] + static_cast<int>(g.adjacentEdges(u).size());
+        for (const auto& edge : g.adjacentEdges(u)) {
+            maxW = std::max(maxW, edge.second);
+            if (edge.second < 0) negative = true;
+        }
+    }
+
+    const std::string partial = path + ".partial";
+    std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("Cannot create graph file: " + partial);
+    writeHeader(out, n, offsetArray[n], withWeights, maxW, negative);
+    out.write(reinterpret_cast<const char*>(offsetArray.data()), static_cast<std::streamsize>(n + 1) * sizeof(int));
+
+    // Adjacency lists are pairs, so targets and weights are written in two streaming passes.
+    std::vector<int> row;
+    for (int pass = 0; pass < (withWeights ? 2 : 1); ++pass) {
+        for (int u = 0; u < n; ++u) {
+            row.clear();
+            for (const auto& edge : g.adjacentEdges(u))
+                row.push_back(pass == 0 ? edge.first : edge.second);
+            out.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()) * sizeof(int));
+        }
+    }
+    commitFile(out, partial, path);
+}
+
+bool CSRGraph::isFileBacked() const {
+    return file != nullptr;
+}
+
+int CSRGraph::numVertices() const {
+    return V;
+}
+
+int CSRGraph::numEdges() const {
+    return offsets[V];
+}
+
+int CSRGraph::outDegree(int u) const {
+    if (u < 0 || u >= V) return 0;
+    return offsets[u + 1] - offsets[u];
+}
+
+int CSRGraph::edgeBegin(int u) const {
+    return offsets[u];
+}
+
+int CSRGraph::edgeEnd(int u) const {
+    return offsets[u + 1];
+}
+
+int CSRGraph::edgeTarget(int e) const {
+    return targets[e];
+}
+
+int CSRGraph::edgeWeight(int e) const {
+    return weights != nullptr ? weights[e] : 1;
+}
+
+CSRGraph CSRGraph::getTranspose() const {
+    std::vector<Edge> reversed;
+    reversed.reserve(numEdges());
+    for (int u = 0; u < V; ++u) {
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e)
+            reversed.push_back({targets[e], u, edgeWeight(e)});
+    }
+    return CSRGraph(V, reversed);
+}
+
+std::vector<int> CSRGraph::BFS(int start) const {
+    std::vector<int> order;
+    if (start < 0 || start >= V) return order;
+
+    // The order vector doubles as the FIFO queue: head advances over it.
+    std::vector<bool> visited(V, false);
+    order.reserve(V);
+    visited[start] = true;
+    order.push_back(start);
+
+    for (size_t head = 0; head < order.size(); ++head) {
+        int u = order[head];
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            int v = targets[e];
+            if (!visited[v]) {
+                visited[v] = true;
+                order.push_back(v);
+            }
+        }
+    }
+    return order;
+}
+
+BFSResult CSRGraph::parallelBFS(int start, ThreadPool& pool, const CSRGraph* incoming) const {
+    // Beamer et al.: go bottom-up when frontier edges exceed unexplored edges / ALPHA,
+    // return top-down once the frontier stops growing and drops below V / BETA.
+    const int64_t ALPHA = 15;
+    const int64_t BETA = 18;
+
+    BFSResult result;
+    result.dist.assign(V, -1);
+    result.parent.assign(V, -1);
+    if (start < 0 || start >= V) return result;
+
+    std::unique_ptr<CSRGraph> ownTranspose;
+    AtomicBitmap visited(V);
+    AtomicBitmap inFrontier(V);
+    int workers = pool.size();
+    std::vector<std::vector<int>> localNext(workers);
+    std::vector<int64_t> localScout(workers);
+
+    std::vector<int> frontier(1, start);
+    visited.set(start);
+    result.dist[start] = 0;
+    result.parent[start] = start;
+
+    int64_t edgesToCheck = numEdges();
+    int64_t scoutCount = outDegree(start);
+    int level = 0;
+
+    // Gathers the per-worker next frontiers and their total out-degree.
+    auto collectNext = [&]() {
+        frontier.clear();
+        scoutCount = 0;
+        for (int w = 0; w < workers; ++w) {
+            frontier.insert(frontier.end(), localNext[w].begin(), localNext[w].end());
+            localNext[w].clear();
+            scoutCount += localScout[w];
+            localScout[w] = 0;
+        }
+    };
+
+    while (!frontier.empty()) {
+        if (scoutCount > edgesToCheck / ALPHA) {
+            if (incoming == nullptr) {
+                ownTranspose.reset(new CSRGraph(getTranspose()));
+                incoming = ownTranspose.get();
+            }
+            size_t previous;
+            do {
+                previous = frontier.size();
+                inFrontier.clear();
+                for (int u : frontier) inFrontier.set(u);
+
+                pool.parallelFor(0, V, [&](int64_t lo, int64_t hi, int w) {
+                    for (int v = static_cast<int>(lo); v < hi; ++v) {
+                        if (visited.test(v)) continue;
+                        for (int e = incoming->offsets[v]; e < incoming->offsets[v + 1]; ++e) {
+                            int u = incoming->targets[e];
+                            if (inFrontier.test(u)) {
+                                visited.set(v);
+                                result.dist[v] = level + 1;
+                                result.parent[v] = u;
+                                localNext[w].push_back(v);
+                                localScout[w] += offsets[v + 1] - offsets[v];
+                                break;
+                            }
+                        }
+                    }
+                }, 4096);
+                collectNext();
+                level++;
+            } while (!frontier.empty() && (frontier.size() >= previous || frontier.size() > static_cast<size_t>(V / BETA)));
+            edgesToCheck -= scoutCount;
+        } else {
+            edgesToCheck -= scoutCount;
+            pool.parallelFor(0, static_cast<int64_t>(frontier.size()), [&](int64_t lo, int64_t hi, int w) {
+                for (int64_t i = lo; i < hi; ++i) {
+                    int u = frontier[i];
+                    for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+                        int v = targets[e];
+                        if (visited.trySet(v)) {
+                            result.dist[v] = level + 1;
+                            result.parent[v] = u;
+                            localNext[w].push_back(v);
+                            localScout[w] += offsets[v + 1] - offsets[v];
+                        }
+                    }
+                }
+            }, 64);
+            collectNext();
+            level++;
+        }
+    }
+    return result;
+}
+
+std::vector<int> CSRGraph::dijkstra(int start) const {
+    std::vector<int> dist(V, INF);
+    if (start < 0 || start >= V) return dist;
+    dist[start] = 0;
+
+    using pii = std::pair<int, int>;
+    std::priority_queue<pii, std::vector<pii>, std::greater<pii>> pq; // {distance, vertex}
+    pq.push({0, start});
+
+    while (!pq.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+
+        if (d > dist[u]) continue;
+
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            int v = targets[e];
+            if (dist[u] + edgeWeight(e) < dist[v]) {
+                dist[v] = dist[u] + edgeWeight(e);
+                pq.push({dist[v], v});
+            }
+        }
+    }
+    return dist;
+}
+
+std::vector<int> CSRGraph::deltaStepping(int start, int delta, ThreadPool& pool) const {
+    if (hasNegativeWeight) return dijkstra(start);
+    std::vector<int> result(V, INF);
+    if (start < 0 || start >= V) return result;
+    if (delta <= 0) {
+        int avgDegree = V > 0 ? std::max(1, numEdges() / V) : 1;
+        delta = std::max(1, maxWeight / avgDegree);
+    }
+
+    std::vector<std::atomic<int>> dist(V);
+    for (int v = 0; v < V; ++v)
+        dist[v].store(INF, std::memory_order_relaxed);
+    dist[start].store(0, std::memory_order_relaxed);
+
+    // Pending distances lie in [i * delta, i * delta + maxWeight], so this many
+    // circular slots never hold two live bucket indices at once.
+    const int64_t numSlots = maxWeight / delta + 2;
+    std::vector<std::vector<int>> slots(numSlots);
+    std::vector<int64_t> bucketOf(V, -1); // Live bucket of each vertex, -1 if none
+    std::vector<int64_t> settledIn(V, -1); // Last bucket each vertex was settled in
+    int workers = pool.size();
+    std::vector<std::vector<int>> improved(workers);
+
+    bucketOf[start] = 0;
+    slots[0].push_back(start);
+
+    // Relaxes edges of `sources` whose weight class matches `light` and files
+    // every vertex that improved into its (possibly new) bucket.
+    auto relaxAll = [&](const std::vector<int>& sources, bool light) {
+        pool.parallelFor(0, static_cast<int64_t>(sources.size()), [&](int64_t lo, int64_t hi, int w) {
+            for (int64_t i = lo; i < hi; ++i) {
+                int u = sources[i];
+                int du = dist[u].load(std::memory_order_relaxed);
+                for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+                    int weight = edgeWeight(e);
+                    if ((weight <= delta) != light) continue;
+                    int candidate = du + weight;
+                    std::atomic<int>& dv = dist[targets[e]];
+                    int current = dv.load(std::memory_order_relaxed);
+                    while (candidate < current && !dv.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+                    }
+                    if (candidate < current) improved[w].push_back(targets[e]);
+                }
+            }
+        }, 256);
+        for (auto& list : improved) {
+            for (int v : list) {
+                int64_t idx = dist[v].load(std::memory_order_relaxed) / delta;
+                if (bucketOf[v] != idx) {
+                    bucketOf[v] = idx;
+                    slots[idx % numSlots].push_back(v);
+                }
+            }
+            list.clear();
+        }
+    };
+
+    std::vector<int> frontier;
+    std::vector<int> settled;
+    int64_t emptyRun = 0;
+    for (int64_t i = 0; emptyRun < numSlots; ++i) {
+        std::vector<int>& slot = slots[i % numSlots];
+        if (slot.empty()) {
+            emptyRun++;
+            continue;
+        }
+        emptyRun = 0;
+        settled.clear();
+
+        while (!slot.empty()) {
+            frontier.clear();
+            for (int v : slot) {
+                if (bucketOf[v] != i) continue; // Stale or duplicate entry
+                bucketOf[v] = -1;
+                frontier.push_back(v);
+                if (settledIn[v] != i) {
+                    settledIn[v] = i;
+                    settled.push_back(v);
+                }
+            }
+            slot.clear();
+            relaxAll(frontier, true);
+        }
+        relaxAll(settled, false);
+    }
+
+    for (int v = 0; v < V; ++v)
+        result[v] = dist[v].load(std::memory_order_relaxed);
+    return result;
+}
+
+std::vector<int> CSRGraph::topologicalSort() const {
+    std::vector<int> inDegree(V, 0);
+    for (int e = 0; e < numEdges(); ++e)
+        inDegree[targets[e]]++;
+
+    std::vector<int> topo;
+    topo.reserve(V);
+    for (int i = 0; i < V; ++i) {
+        if (inDegree[i] == 0)
+            topo.push_back(i);
+    }
+
+    for (size_t head = 0; head < topo.size(); ++head) {
+        int u = topo[head];
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            if (--inDegree[targets[e]] == 0)
+                topo.push_back(targets[e]);
+        }
+    }
+
+    return static_cast<int>(topo.size()) == V ? topo : std::vector<int>(); // Empty if cycle exists
+}
+
+std::vector<std::vector<int>> CSRGraph::getSCCs() const {
+    // 1. Record vertices by finishing time with an explicit {vertex, next edge} stack.
+    std::vector<bool> visited(V, false);
+    std::vector<int> finishOrder;
+    finishOrder.reserve(V);
+    std::vector<std::pair<int, int>> dfsStack;
+
+    for (int s = 0; s < V; ++s) {
+        if (visited[s]) continue;
+        visited[s] = true;
+        dfsStack.push_back({s, offsets[s]});
+
+        while (!dfsStack.empty()) {
+            int u = dfsStack.back().first;
+            int& e = dfsStack.back().second;
+            if (e < offsets[u + 1]) {
+                int v = targets[e++];
+                if (!visited[v]) {
+                    visited[v] = true;
+                    dfsStack.push_back({v, offsets[v]});
+                }
+            } else {
+                finishOrder.push_back(u);
+                dfsStack.pop_back();
+            }
+        }
+    }
+
+    // 2. Collect components on the transpose in decreasing finishing time.
+    CSRGraph transposed = getTranspose();
+    std::fill(visited.begin(), visited.end(), false);
+    std::vector<std::vector<int>> sccs;
+    std::vector<int> collectStack;
+
+    for (int i = V - 1; i >= 0; --i) {
+        int s = finishOrder[i];
+        if (visited[s]) continue;
+
+        std::vector<int> component;
+        visited[s] = true;
+        collectStack.push_back(s);
+        while (!collectStack.empty()) {
+            int u = collectStack.back();
+            collectStack.pop_back();
+            component.push_back(u);
+            for (int e = transposed.offsets[u]; e < transposed.offsets[u + 1]; ++e) {
+                int v = transposed.targets[e];
+                if (!visited[v]) {
+                    visited[v] = true;
+                    collectStack.push_back(v);
+                }
+            }
+        }
+        sccs.push_back(component);
+    }
+    return sccs;
+}
+
+int CSRGraph::primMST() const {
+    if (V == 0) return 0;
+    std::vector<int> key(V, INF);
+    std::vector<bool> inMST(V, false);
+    key[0] = 0;
+
+    using pii = std::pair<int, int>;
+    std::priority_queue<pii, std::vector<pii>, std::greater<pii>> pq; // {key, vertex}
+    pq.push({0, 0});
+
+    int totalWeight = 0;
+
+    while (!pq.empty()) {
+        int u = pq.top().second;
+        pq.pop();
+
+        if (inMST[u]) continue;
+        inMST[u] = true;
+        totalWeight += key[u];
+
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            int v = targets[e];
+            if (!inMST[v] && edgeWeight(e) < key[v]) {
+                key[v] = edgeWeight(e);
+                pq.push({key[v], v});
+            }
+        }
+    }
+    return totalWeight;
+}
+
+} // namespace data_structures
+
+#endif // CSR_GRAPH_HPP
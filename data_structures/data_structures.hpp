@@ -16,9 +16,20 @@
 #include "Queue.hpp"
 #include "Stack.hpp"
 #include "Trie.hpp"
+#include "visitor.hpp"
 #include "Tree.hpp"
 #include "Singly_Linked_List.hpp"
+#include "thread_pool.hpp"
 #include "graph.hpp"
+#include "csr_graph.hpp"
+#include "shortest_path_engine.hpp"
+#include "contraction_hierarchy.hpp"
+#include "edge_list_loader.hpp"
+#include "dynamic_graph.hpp"
+#include "vertex_ordering.hpp"
+#include "page_rank.hpp"
+#include "max_flow.hpp"
+#include "bipartite_matching.hpp"
 #include "disjointset.hpp"
 #endif // DATA_STRUCTURES_HPP
 
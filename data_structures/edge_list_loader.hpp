@@ -0,0 +1,230 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef EDGE_LIST_LOADER_HPP
+#define EDGE_LIST_LOADER_HPP
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include "graph.hpp"
+#include "csr_graph.hpp"
+#include "thread_pool.hpp"
+
+namespace data_structures {
+
+/**
+ * @brief Parses large text edge lists in parallel and bulk-builds graphs from them.
+ *
+ * Each line is `u v` or `u v w` (whitespace separated, weight defaults to 1).
+ * Blank lines and lines starting with '#' or '%' are skipped, and CRLF endings are
+ * accepted. The file is memory-mapped and split into chunks at line boundaries;
+ * workers parse chunks with a hand-written integer scanner into per-chunk edge
+ * arrays, which are then concatenated in parallel. Graphs are built in bulk
+ * (CSR by a parallel counting sort, Graph through addEdges) rather than edge by edge.
+ */
+class EdgeListLoader {
+private:
+    /**
+     * @brief Target bytes per parse chunk; small enough to balance load across workers.
+     */
+    static const size_t CHUNK_BYTES = 1 << 22;
+
+    ThreadPool& pool;  ///< Workers used for parsing and building
+    int maxVertexId;   ///< Largest vertex id seen by the last parse (-1 if none)
+
+    /**
+     * @brief Parses one line starting at p into e and advances p past the line.
+     * @return False if the line is malformed
+     */
+    static bool parseLine(const char*& p, const char* end, Edge& e, bool& isEdge);
+
+    /**
+     * @brief Reads a decimal integer at p (optional leading '-') and advances p.
+     * @return False if there is no number or it does not fit in an int
+     */
+    static bool parseInt(const char*& p, const char* end, int& out);
+
+public:
+    /**
+     * @brief Creates a loader that runs on the given pool.
+     */
+    explicit EdgeListLoader(ThreadPool& workers = ThreadPool::defaultPool());
+
+    /**
+     * @brief Parses an in-memory edge list.
+     * @param text Start of the text
+     * @param length Number of bytes
+     * @return Edges in text order
+     * @throws std::runtime_error on a malformed line or a vertex id of INF or more
+     *         (the message gives the line's byte offset)
+     */
+    std::vector<Edge> parse(const char* text, size_t length);
+
+    /**
+     * @brief Parses an edge list file.
+     * @param path File to read
+     * @return Edges in file order
+     * @throws std::runtime_error if the file cannot be read or a line is malformed
+     */
+    std::vector<Edge> parseFile(const std::string& path);
+
+    /**
+     * @brief Number of vertices implied by the last parse (largest id + 1).
+     */
+    int inferredVertices() const;
+
+    /**
+     * @brief Loads an edge list file into a CSRGraph (neighbors keep file order).
+     * @param path File to read
+     * @param vertices Vertex count; -1 infers it from the largest id
+     * @throws std::runtime_error if the file cannot be read or a line is malformed
+     */
+    CSRGraph loadCSR(const std::string& path, int vertices = -1);
+
+    /**
+     * @brief Loads an edge list file into a Graph (adjacency lists keep file order).
+     * @param path File to read
+     * @param vertices Vertex count; -1 infers it from the largest id
+     * @throws std::runtime_error if the file cannot be read or a line is malformed
+     */
+    Graph loadGraph(const std::string& path, int vertices = -1);
+};
+
+// --- Method Implementations ---
+
+EdgeListLoader::EdgeListLoader(ThreadPool& workers) : pool(workers), maxVertexId(-1) {}
+
+bool EdgeListLoader::parseInt(const char*& p, const char* end, int& out) {
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        ++p;
+    }
+    if (p == end || *p < '0' || *p > '9') return false;
+    int64_t value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p++ - '0');
+        if (value > INF) return false;
+    }
+    out = static_cast<int>(negative ? -value : value);
+    return true;
+}
+
+bool EdgeListLoader::parseLine(const char*& p, const char* end, Edge& e, bool& isEdge) {
+    auto skipBlanks = [&]() { while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p; };
+    auto skipLine = [&]() { while (p < end && *p++ != '\n') {} };
+
+    isEdge = false;
+    skipBlanks();
+    if (p == end || *p == '\n' || *p == '#' || *p == '%') {
+        skipLine();
+        return true;
+    }
+
+    if (!parseInt(p, end, e.u)) return false;
+    skipBlanks();
+    if (!parseInt(p, end, e.v)) return false;
+    skipBlanks();
+    e.weight = 1;
+    if (p < end && *p != '\n' && !parseInt(p, end, e.weight)) return false;
+    skipBlanks();
+    if (p < end && *p != '\n') return false; // Trailing garbage
+    if (e.u < 0 || e.v < 0) return false;
+    if (e.u >= INF || e.v >= INF) return false; // The vertex count id + 1 must fit in an int
+    if (p < end) ++p;
+    isEdge = true;
+    return true;
+}
+
+std::vector<Edge> EdgeListLoader::parse(const char* text, size_t length) {
+    const char* end = text + length;
+
+    // Chunk boundaries are moved forward to the next line start.
+    size_t chunks = std::max<size_t>(1, std::min<size_t>(length / CHUNK_BYTES + 1, static_cast<size_t>(pool.size()) * 8));
+    std::vector<const char*> bounds(chunks + 1, end);
+    bounds[0] = text;
+    for (size_t c = 1; c < chunks; ++c) {
+        const char* p = std::max(bounds[c - 1], text + length * c / chunks);
+        while (p < end && p > text && p[-1] != '\n') ++p;
+        bounds[c] = p;
+    }
+
+    std::vector<std::vector<Edge>> parts(chunks);
+    std::vector<int> partMax(chunks, -1);
+    std::vector<int64_t> badOffset(chunks, -1);
+    pool.parallelFor(0, static_cast<int64_t>(chunks), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t c = lo; c < hi; ++c) {
+            std::vector<Edge>& out = parts[c];
+            out.reserve(static_cast<size_t>(bounds[c + 1] - bounds[c]) / 8);
+            const char* p = bounds[c];
+            while (p < bounds[c + 1]) {
+                const char* lineStart = p;
+                Edge e;
+                bool isEdge;
+                if (!parseLine(p, end, e, isEdge)) {
+                    badOffset[c] = lineStart - text;
+                    break;
+                }
+                if (!isEdge) continue;
+                out.push_back(e);
+                partMax[c] = std::max(partMax[c], std::max(e.u, e.v));
+            }
+        }
+    }, 1);
+
+    for (size_t c = 0; c < chunks; ++c) {
+        if (badOffset[c] >= 0)
+            throw std::runtime_error("Malformed edge list line at byte " + std::to_string(badOffset[c]));
+    }
+
+    std::vector<size_t> start(chunks + 1, 0);
+    maxVertexId = -1;
+    for (size_t c = 0; c < chunks; ++c) {
+        start[c + 1] = start[c] + parts[c].size();
+        maxVertexId = std::max(maxVertexId, partMax[c]);
+    }
+    std::vector<Edge> edges(start[chunks]);
+    pool.parallelFor(0, static_cast<int64_t>(chunks), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t c = lo; c < hi; ++c) {
+            std::copy(parts[c].begin(), parts[c].end(), edges.begin() + start[c]);
+            std::vector<Edge>().swap(parts[c]);
+        }
+    }, 1);
+    return edges;
+}
+
+std::vector<Edge> EdgeListLoader::parseFile(const std::string& path) {
+    MappedFile file(path);
+    return parse(file.data(), file.size());
+}
+
+int EdgeListLoader::inferredVertices() const {
+    return maxVertexId + 1;
+}
+
+CSRGraph EdgeListLoader::loadCSR(const std::string& path, int vertices) {
+    std::vector<Edge> edges = parseFile(path);
+    return CSRGraph(vertices < 0 ? inferredVertices() : vertices, edges, pool);
+}
+
+Graph EdgeListLoader::loadGraph(const std::string& path, int vertices) {
+    std::vector<Edge> edges = parseFile(path);
+    Graph g(vertices < 0 ? inferredVertices() : vertices);
+    g.addEdges(edges);
+    return g;
+}
+
+} // namespace data_structures
+
+#endif // EDGE_LIST_LOADER_HPP
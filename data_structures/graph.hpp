@@ -20,6 +20,14 @@
 #include <utility>
 #include <limits>
 #include <functional>
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
+#include <random>
+#include <unordered_map>
+#include "thread_pool.hpp"
+#include "disjointset.hpp"
+#include "visitor.hpp"
 
 // Using declarations to avoid repeating std::
 using std::vector;
@@ -37,48 +45,371 @@ using std::numeric_limits;
 const int INF = numeric_limits<int>::max();
 
 namespace data_structures{
+/**
+ * @brief Weight type of unweighted graphs.
+ *
+ * It is empty, so adjacency entries of a graph with NoWeight store only the
+ * neighbor. Every edge costs 1 in the shortest-path and spanning-tree algorithms.
+ */
+struct NoWeight {
+    /** @brief Prints the implicit unit weight. */
+    friend std::ostream& operator<<(std::ostream& os, NoWeight) { return os << 1; }
+};
+
+/**
+ * @brief Maps an edge weight type to the type used for path lengths.
+ *
+ * Distance is the weight type itself; infinity() is the IEEE infinity for
+ * floating-point weights and the largest value otherwise. Use a wider weight
+ * type (e.g. int64_t) when sums of int weights could overflow.
+ */
+template <typename Weight>
+struct WeightTraits {
+    using Distance = Weight;
+
+    /** @brief Cost of traversing an edge of weight w. */
+    static Distance cost(const Weight& w) { return w; }
+
+    /** @brief Weight used by addEdge when none is given. */
+    static Weight unit() { return Weight(1); }
+
+    /** @brief Distance of unreachable vertices. */
+    static Distance infinity() {
+        return numeric_limits<Distance>::has_infinity ? numeric_limits<Distance>::infinity()
+                                                      : numeric_limits<Distance>::max();
+    }
+};
+
+/**
+ * @brief Unweighted graphs measure paths in edges, with int distances.
+ */
+template <>
+struct WeightTraits<NoWeight> {
+    using Distance = int;
+    static Distance cost(NoWeight) { return 1; }
+    static NoWeight unit() { return NoWeight(); }
+    static Distance infinity() { return INF; }
+};
+
+/**
+ * @brief A single weighted, directed edge u -> v.
+ */
+template <typename VertexId, typename Weight>
+struct BasicEdge {
+    VertexId u;    ///< Source vertex
+    VertexId v;    ///< Destination vertex
+    Weight weight; ///< Weight of the edge
+};
+
+using Edge = BasicEdge<int, int>;
+
+/**
+ * @brief One adjacency list entry: {neighbor, weight}.
+ *
+ * Members are named first/second like the std::pair it replaces. For an empty
+ * weight type (NoWeight) the weight is a static member, so the entry is exactly
+ * one VertexId wide.
+ */
+template <typename VertexId, typename Weight, bool = std::is_empty<Weight>::value>
+struct AdjacencyEntry {
+    VertexId first; ///< Neighbor
+    Weight second;  ///< Edge weight
+
+    AdjacencyEntry() = default;
+    AdjacencyEntry(VertexId neighbor, Weight weight) : first(neighbor), second(weight) {}
+};
+
+template <typename VertexId, typename Weight>
+struct AdjacencyEntry<VertexId, Weight, true> {
+    VertexId first;                   ///< Neighbor
+    static constexpr Weight second{}; ///< Edge weight (stateless)
+
+    AdjacencyEntry() = default;
+    AdjacencyEntry(VertexId neighbor, Weight = Weight()) : first(neighbor) {}
+};
+
+/**
+ * @brief Open-addressing hash set of directed (u, v) vertex pairs.
+ *
+ * Keys are packed into one 64-bit word and stored with linear probing;
+ * erase uses backward-shift deletion so no tombstones accumulate.
+ */
+class EdgeHashSet {
+private:
+    static constexpr uint64_t EMPTY = ~0ULL;
+    vector<uint64_t> slots; ///< Packed keys, EMPTY for free slots
+    size_t count;           ///< Number of stored keys
+
+    static uint64_t pack(int u, int v);
+    static uint64_t mix(uint64_t key);
+    size_t slotOf(uint64_t key) const;
+    void grow();
+
+public:
+    /**
+     * @brief Constructs an empty set.
+     */
+    EdgeHashSet();
+
+    /**
+     * @brief Inserts (u, v). Does nothing if it is already present.
+     */
+    void insert(int u, int v);
+
+    /**
+     * @brief Pre-sizes the table so n keys fit without rehashing.
+     */
+    void reserve(size_t n);
+
+    /**
+     * @brief Removes (u, v) if present.
+     */
+    void erase(int u, int v);
+
+    /**
+     * @brief Checks whether (u, v) is present.
+     */
+    bool contains(int u, int v) const;
+
+    /**
+     * @brief Returns the number of stored pairs.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Removes all pairs and releases the table.
+     */
+    void clear();
+};
+
+/**
+ * @brief Strongly connected components stored as one flat array plus offsets.
+ *
+ * Component c consists of vertices[offsets[c] .. offsets[c + 1]). Components are
+ * numbered in the order they complete, which is a reverse topological order of
+ * the condensation (sink components first).
+ */
+template <typename VertexId>
+struct BasicSCCResult {
+    vector<VertexId> vertices; ///< All vertices, grouped by component
+    vector<int> offsets;       ///< Size count() + 1: start of each component in vertices
+    vector<int> componentOf;   ///< Component id of each vertex
+
+    /** @brief Returns the number of components. */
+    int count() const { return static_cast<int>(offsets.size()) - 1; }
+};
+
+using SCCResult = BasicSCCResult<int>;
+
+/**
+ * @brief Topological order grouped into levels, plus the critical (heaviest) path.
+ *
+ * Level 0 holds the sources and a vertex sits one level below its deepest
+ * predecessor, so all vertices of a level can run concurrently once the earlier
+ * levels are done. Edge weights are read as durations along a path.
+ */
+template <typename VertexId, typename Distance>
+struct BasicTopologicalLevels {
+    vector<VertexId> vertices;      ///< Vertices level by level, ascending id within a level
+    vector<int> offsets;            ///< Size count() + 1: start of each level in vertices
+    vector<int> levelOf;            ///< Level of each vertex (-1 if on or after a cycle)
+    vector<Distance> longestPathTo; ///< Heaviest path weight ending at each vertex (0 for sources)
+    vector<VertexId> criticalPath;  ///< A heaviest path of the DAG, from its source to its sink
+    Distance criticalLength{};      ///< Total weight of criticalPath
+    bool acyclic = true;            ///< False if a cycle blocked some vertices
+
+    /** @brief Returns the number of levels. */
+    int count() const { return static_cast<int>(offsets.size()) - 1; }
+};
+
+using TopologicalLevels = BasicTopologicalLevels<int, int>;
+
+/**
+ * @brief Two-coloring of a graph, as returned by BasicGraph::bipartition().
+ */
+struct Bipartition {
+    bool bipartite = true; ///< False if the graph has an odd cycle (or a self-loop)
+    vector<char> side;     ///< Side (0 or 1) of each vertex; only meaningful if bipartite
+};
+
 /**
  * @brief Graph class supporting weighted edges for various algorithms.
+ *
+ * Edges live in an adjacency list; edgeExists() is answered by a hash set of
+ * (u, v) pairs, so memory is O(V + E). The dense V x V adjacency matrix is
+ * only built when explicitly requested through getAdjMatrix().
+ *
+ * VertexId is the integer type of vertex ids (at most 32 bits; uint32_t halves
+ * adjacency memory compared to 64-bit ids). Weight is any arithmetic type, or
+ * NoWeight for unweighted graphs. Distances use WeightTraits<Weight>::Distance
+ * and unreachable vertices get WeightTraits<Weight>::infinity().
  */
-class Graph {
+template <typename VertexId = int, typename Weight = int>
+class BasicGraph {
+    static_assert(std::is_integral<VertexId>::value && sizeof(VertexId) <= sizeof(uint32_t),
+                  "VertexId must be an integer type of at most 32 bits");
+
+public:
+    using Distance = typename WeightTraits<Weight>::Distance; ///< Path length type
+    using EdgeType = BasicEdge<VertexId, Weight>;             ///< Flat edge type
+    using Entry = AdjacencyEntry<VertexId, Weight>;           ///< Adjacency list entry
+
 private:
-    int V; ///< Number of vertices
-    vector<vector<pair<int, int>>> adjList; ///< Adjacency list: {neighbor, weight}
-    vector<vector<int>> adjMatrix; ///< Adjacency matrix: stores weights
+    VertexId V; ///< Number of vertices
+    vector<vector<Entry>> adjList; ///< Adjacency list: {neighbor, weight}
+    vector<vector<Distance>> adjMatrix; ///< Adjacency matrix: stores weights (empty until requested)
+    EdgeHashSet edgeSet; ///< Set of existing (u, v) edges for O(1) lookups
+    Distance maxEdgeWeight; ///< Largest weight ever added (upper bound after removals)
+    bool hasNegativeWeight; ///< True once any negative-weight edge was added
+    bool sortedNeighbors; ///< True in sorted-neighbors mode: every list is ordered by neighbor
+    vector<vector<VertexId>> dialBuckets; ///< Circular bucket queue reused by dialDijkstra
+
+    /**
+     * @brief Parent of DFS roots; never a valid vertex.
+     */
+    static constexpr VertexId NO_VERTEX = numeric_limits<VertexId>::max();
+
+    /**
+     * @brief One suspended call of an iterative DFS.
+     */
+    struct DfsFrame {
+        VertexId vertex; ///< Vertex being expanded
+        int edge;        ///< Index of the next edge of vertex to examine
+        VertexId parent; ///< Vertex we came from (NO_VERTEX for a root)
+    };
 
     /**
-     * @brief Utility function for DFS.
-     * @param v Current vertex
-     * @param visited Visited status array
+     * @brief Scratch space shared by the iterative DFS routines.
+     *
+     * Buffers keep their capacity between calls, so after the first traversal
+     * no DFS allocates on the heap.
      */
-    void dfsUtil(int v, vector<bool>& visited);
+    struct TraversalArena {
+        vector<char> mark;       ///< Per-vertex state; meaning depends on the algorithm
+        vector<DfsFrame> frames; ///< Explicit recursion stack
+        vector<VertexId> order;  ///< Vertex output buffer (e.g. finishing order)
+        vector<int> number;      ///< Per-vertex integer scratch (e.g. DFS indices)
+
+        /** @brief Clears all marks for n vertices and empties the buffers. */
+        void reset(VertexId n);
+    };
+
+    TraversalArena arena; ///< Reused by every DFS-based algorithm
+
+    /**
+     * @brief Cost of an edge of weight w (1 for NoWeight).
+     */
+    static Distance cost(const Weight& w) { return WeightTraits<Weight>::cost(w); }
+
+    /**
+     * @brief Lists at least this many times longer than the other are galloped through, not merged.
+     */
+    static const int GALLOP_RATIO = 16;
+
+    /**
+     * @brief Galloping narrows the search to a block this long, then counts it without branches.
+     */
+    static const int GALLOP_BLOCK = 16;
+
+    /**
+     * @brief Number of distinct neighbors shared by two sorted ranges of adjacency entries.
+     *
+     * Merges when the ranges have similar lengths; otherwise every distinct entry of
+     * the shorter range gallops (exponential search) through the longer one and
+     * finishes with a branch-free count over one small block, which compilers vectorize.
+     */
+    static int64_t countCommon(const Entry* a, const Entry* aEnd, const Entry* b, const Entry* bEnd);
+
+    /**
+     * @brief First entry of u's sorted list whose neighbor is greater than x.
+     */
+    const Entry* firstAbove(VertexId u, VertexId x) const;
+
+    /**
+     * @brief Iterative DFS from v looking for a back edge (directed cycle).
+     * @param v Start vertex; arena.mark holds 0 = new, 1 = on stack, 2 = finished
+     * @return True if a cycle is reachable from v
+     */
+    bool dfsDirectedCycleUtil(VertexId v);
+
+    /**
+     * @brief Iterative DFS from v looking for a non-tree edge (undirected cycle).
+     * @param v Start vertex; arena.mark holds 1 for visited vertices
+     * @return True if a cycle is found in v's component
+     */
+    bool dfsUndirectedCycleUtil(VertexId v);
 
 public:
     /**
      * @brief Constructor to initialize the graph.
      * @param vertices Number of vertices
      */
-    Graph(int vertices);
+    BasicGraph(VertexId vertices);
+
+    /**
+     * @brief Returns the distance reported for unreachable vertices.
+     */
+    static Distance infinity() { return WeightTraits<Weight>::infinity(); }
 
     /**
      * @brief Adds a weighted edge from u to v.
      * @param u Source vertex
      * @param v Destination vertex
-     * @param weight Weight of the edge
+     * @param weight Weight of the edge (1 if omitted)
+     */
+    void addEdge(VertexId u, VertexId v, Weight weight = WeightTraits<Weight>::unit());
+
+    /**
+     * @brief Adds many edges at once (same effect as addEdge on each, in order).
+     *
+     * Counts edges per source first so every adjacency list and the edge set are
+     * sized once, instead of growing edge by edge.
+     * @param edges Edges to add; out-of-range edges are ignored
+     */
+    void addEdges(const vector<EdgeType>& edges);
+
+    /**
+     * @brief Breadth-first traversal from start that reports events to a visitor.
+     *
+     * Vertices are discovered in BFS order (start first); each discovered vertex
+     * then has its out-edges examined in adjacency order and is finished. The
+     * visitor is a template parameter (see GraphVisitor), so its callbacks are
+     * inlined. Scratch space is the graph's traversal arena: callbacks must not
+     * start another traversal of this graph.
+     * @param start Starting vertex
+     * @param visitor Object with discoverVertex / examineEdge / finishVertex
+     * @return False if a callback returned VisitAction::Stop, true otherwise
+     * @throws std::out_of_range if start is not a vertex
+     */
+    template <typename Visitor>
+    bool breadthFirstVisit(VertexId start, Visitor&& visitor);
+
+    /**
+     * @brief Depth-first traversal from start that reports events to a visitor.
+     *
+     * Vertices are discovered in preorder and finished in postorder; edges of a
+     * vertex are examined in adjacency order, each right before the walk may
+     * descend along it. Iterative, so deep graphs cannot overflow the call stack.
+     * Callbacks must not start another traversal of this graph.
+     * @param start Starting vertex
+     * @param visitor Object with discoverVertex / examineEdge / finishVertex
+     * @return False if a callback returned VisitAction::Stop, true otherwise
+     * @throws std::out_of_range if start is not a vertex
      */
-    void addEdge(int u, int v, int weight);
+    template <typename Visitor>
+    bool depthFirstVisit(VertexId start, Visitor&& visitor);
 
     /**
      * @brief Performs Breadth-First Search from a given vertex (ignores weights).
      * @param start Starting vertex
      */
-    void BFS(int start);
+    void BFS(VertexId start);
 
     /**
      * @brief Performs Depth-First Search from a given vertex (ignores weights).
      * @param start Starting vertex
      */
-    void DFS(int start);
+    void DFS(VertexId start);
 
     /**
      * @brief Prints the adjacency list of the graph.
@@ -86,15 +417,50 @@ public:
     void printAdjList();
 
     /**
-     * @brief Prints the adjacency matrix of the graph.
+     * @brief Prints the adjacency matrix of the graph (row by row, without materializing it).
      */
     void printAdjMatrix();
-    
+
+    /**
+     * @brief Returns the dense adjacency matrix, building it on first use.
+     *
+     * Once built, the matrix is kept in sync by edge updates until releaseAdjMatrix().
+     * @return V x V matrix of weights (0 means no edge)
+     */
+    const vector<vector<Distance>>& getAdjMatrix();
+
+    /**
+     * @brief Frees the dense adjacency matrix if it was built.
+     */
+    void releaseAdjMatrix();
+
+    /**
+     * @brief Checks whether the dense adjacency matrix is currently materialized.
+     */
+    bool hasAdjMatrix() const;
+
     /**
      * @brief Performs Topological Sort (only valid for DAGs).
      * @return A vector with topological order or empty if cycle detected.
      */
-    vector<int> topologicalSort();
+    vector<VertexId> topologicalSort();
+
+    /**
+     * @brief Parallel level-by-level topological sort that also finds the critical path.
+     *
+     * Kahn's algorithm one wavefront at a time: in-degrees are counted with atomic
+     * increments, every vertex of the current level decrements its successors in
+     * parallel, and whichever thread drops a count to zero puts that vertex in the
+     * next level. The same pass keeps the heaviest path weight into each vertex with
+     * an atomic max, so the critical path needs just one more edge scan to choose
+     * predecessors (the smallest one on ties, so results are deterministic).
+     *
+     * If the graph has a cycle, acyclic is false, the levels stop before the vertices
+     * on or after the cycle, and the path fields are left empty.
+     * @param pool Worker threads
+     * @return Levels, per-vertex longest path weights and one critical path
+     */
+    BasicTopologicalLevels<VertexId, Distance> topologicalLevels(ThreadPool& pool = ThreadPool::defaultPool());
 
     /**
      * @brief Detects cycle in a directed graph using DFS.
@@ -115,84 +481,251 @@ public:
     int countConnectedComponents();
 
     /**
-     * @brief Checks whether the graph is bipartite using BFS.
+     * @brief Labels weakly connected components in parallel with the Afforest algorithm.
+     *
+     * Edge direction is ignored. Every vertex first links along its first two edges
+     * through a lock-free union-find (CAS hooks the larger root under the smaller),
+     * then a random sample finds the largest intermediate component. Edges of that
+     * component are only checked with a read; all other remaining edges are linked.
+     * A final pointer-jumping pass flattens the trees.
+     * @param pool Worker threads
+     * @return Component label per vertex: the smallest vertex id in its component
+     *         (so the number of components is the number of v with label[v] == v)
+     */
+    vector<VertexId> connectedComponents(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Checks whether the graph is bipartite; see bipartition().
      * @return True if bipartite.
      */
     bool isBipartite();
 
+    /**
+     * @brief Two-colors the graph by BFS, ignoring edge direction.
+     *
+     * Each edge is followed both ways (through a temporary undirected CSR), so a
+     * graph whose edges all point from one side to the other is colored correctly.
+     * The smallest vertex of every weakly connected component gets side 0.
+     * @return The coloring; bipartite is false if some cycle has odd length
+     */
+    Bipartition bipartition() const;
+
+    /**
+     * @brief Sorts every adjacency list by neighbor id and keeps them sorted from now on.
+     *
+     * In sorted-neighbors mode addEdge inserts at the sorted position (O(degree)) and
+     * addEdges merges each touched list once; parallel edges keep their insertion
+     * order. Sorted lists let triangle counting and k-cores intersect neighborhoods
+     * in linear time instead of probing edgeExists in nested loops.
+     * @param pool Worker threads sorting the lists
+     */
+    void sortNeighbors(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Checks whether the graph is in sorted-neighbors mode.
+     */
+    bool hasSortedNeighbors() const;
+
+    /**
+     * @brief Counts triangles of the undirected graph.
+     *
+     * Expects symmetric adjacency (e.g. after makeUndirected()); parallel edges and
+     * self-loops are ignored. Each triangle u < v < w is found once, by intersecting
+     * the parts of N(u) and N(v) above v, in parallel over u. Switches the graph to
+     * sorted-neighbors mode if it is not already.
+     * @param pool Worker threads
+     * @return Number of triangles
+     */
+    int64_t countTriangles(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Number of triangles through each vertex (same conventions as countTriangles).
+     *
+     * Every vertex intersects its own neighborhood with each neighbor's, so workers
+     * only write their own vertices' counts.
+     * @param pool Worker threads
+     * @return Per-vertex triangle counts
+     */
+    vector<int64_t> triangleCounts(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Local clustering coefficient of each vertex.
+     *
+     * triangles(v) / (d(v) * (d(v) - 1) / 2), where d(v) counts distinct neighbors
+     * other than v; vertices with fewer than two neighbors get 0.
+     * @param pool Worker threads
+     */
+    vector<double> clusteringCoefficients(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Core number of every vertex (largest k such that v is in the k-core).
+     *
+     * Batagelj-Zaversnik bucket algorithm in O(V + E): vertices sit in buckets by
+     * current degree and are peeled in increasing order, each removal moving its
+     * neighbors down one bucket in O(1). Same input conventions as countTriangles.
+     * @return Core numbers; the maximum is the graph's degeneracy
+     */
+    vector<int> coreNumbers();
+
     /**
      * @brief Computes shortest path from start using Dijkstra's algorithm.
      * @param start Source vertex.
      * @return Vector of shortest distances.
      */
-    vector<int> dijkstra(int start);
-    
+    vector<Distance> dijkstra(VertexId start);
+
+    /**
+     * @brief Largest edge weight for which dialDijkstra uses its bucket queue.
+     */
+    static const int DIAL_MAX_WEIGHT = 1 << 16;
+
+    /**
+     * @brief Dijkstra with Dial's circular bucket queue, for small non-negative integer weights.
+     *
+     * Uses maxWeight + 1 buckets, giving O(1) queue operations and O(V + E + maxDist)
+     * total time. Buckets are kept between calls, so repeated queries do not reallocate
+     * them (the method is therefore not safe to call concurrently on one Graph).
+     * Falls back to dijkstra() for floating-point weights, or if any weight is negative
+     * or exceeds DIAL_MAX_WEIGHT.
+     * @param start Source vertex.
+     * @return Vector of shortest distances, identical to dijkstra(start).
+     */
+    vector<Distance> dialDijkstra(VertexId start);
+
     /**
      * @brief Bellman-Ford algorithm to find shortest path from source.
      * @param start Starting vertex
      * @return Pair: distances vector and boolean (true if negative weight cycle exists)
      */
-    std::pair<std::vector<int>, bool> bellmanFord(int start);
+    std::pair<std::vector<Distance>, bool> bellmanFord(VertexId start);
+
+    /**
+     * @brief Shortest Path Faster Algorithm: queue-based Bellman-Ford.
+     *
+     * Only vertices whose distance just improved are re-scanned. A negative cycle
+     * is reported once some shortest path would need V or more edges.
+     * @param start Starting vertex
+     * @return Pair: distances vector and boolean (true if negative weight cycle exists)
+     */
+    std::pair<std::vector<Distance>, bool> spfa(VertexId start);
+
+    /**
+     * @brief Bellman-Ford with each round's edge relaxations split across threads.
+     *
+     * Relaxes a flat edge array with an atomic compare-and-swap minimum and stops
+     * as soon as a round changes nothing. Distances match bellmanFord() whenever no
+     * negative cycle is reachable.
+     * @param start Starting vertex
+     * @param pool Worker threads
+     * @return Pair: distances vector and boolean (true if negative weight cycle exists)
+     */
+    std::pair<std::vector<Distance>, bool> parallelBellmanFord(VertexId start, ThreadPool& pool = ThreadPool::defaultPool());
 
     /**
      * @brief Computes MST total weight using Prim's algorithm.
      * @return Total weight of MST
      */
-    int primMST();
+    Distance primMST();
 
     /**
-     * @brief Finds all Strongly Connected Components (SCCs) using Kosaraju's algorithm.
-     * @return Vector of components (each as vector<int>)
+     * @brief Minimum spanning forest with Kruskal's algorithm.
+     *
+     * Edges are treated as undirected. The flat edge array is sorted in parallel by
+     * (weight, u, v) and joined with the library's DisjointSet, so disconnected
+     * graphs yield one tree per component.
+     * @param pool Worker threads for the sort
+     * @return Forest edges in increasing weight order
      */
-    std::vector<std::vector<int>> getSCCs();
+    vector<EdgeType> kruskalMST(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Minimum spanning forest with Borůvka's algorithm.
+     *
+     * Each round runs entirely in parallel. It finds every component's lightest outgoing
+     * edge (atomic compare-and-swap on the edge index, ordered by {weight, edge index}
+     * so ties are broken consistently), and hooks each component to the one across
+     * that edge. Pointer jumping over the component parents then relabels vertices,
+     * and a count / prefix-sum / scatter pass drops the edges that became internal.
+     * Components at least halve per round.
+     * @param pool Worker threads
+     * @return Forest edges (same total weight as kruskalMST)
+     */
+    vector<EdgeType> boruvkaMST(ThreadPool& pool = ThreadPool::defaultPool());
+
+    /**
+     * @brief Finds all Strongly Connected Components (SCCs); see getSCCsFlat().
+     * @return Vector of components (each as a vector of vertices)
+     */
+    std::vector<std::vector<VertexId>> getSCCs();
+
+    /**
+     * @brief Finds SCCs with Pearce's single-pass, iterative variant of Tarjan's algorithm.
+     *
+     * Needs no transposed graph and no per-vertex allocation: scratch space comes
+     * from the shared traversal arena and the result is three flat arrays.
+     * @return Components as a flat vertex array plus offsets
+     */
+    BasicSCCResult<VertexId> getSCCsFlat();
 
     /**
      * @brief Floyd-Warshall all-pairs shortest paths algorithm.
      * @return 2D vector of distances between all pairs
      */
-    std::vector<std::vector<int>> floydWarshall();
+    std::vector<std::vector<Distance>> floydWarshall();
+
+    /**
+     * @brief Cache-blocked, multi-threaded Floyd-Warshall over one contiguous buffer.
+     *
+     * Runs the standard three-phase blocked algorithm on BLOCK x BLOCK tiles: the
+     * diagonal tile, then its row and column tiles in parallel, then all remaining
+     * tiles in parallel. The branch-free inner min-plus loop is auto-vectorizable.
+     * Finite distances are assumed to stay within (-infinity() / 4, infinity() / 4).
+     * @param pool Worker threads for the independent tiles of each phase
+     * @return Row-major V * V distances: entry (i, j) is at [i * V + j], infinity() if unreachable
+     */
+    std::vector<Distance> floydWarshallBlocked(ThreadPool& pool = ThreadPool::defaultPool());
 
     /**
      * @brief Removes the edge from u to v (one-way).
      * @param u Source vertex
      * @param v Destination vertex
      */
-    void removeEdge(int u, int v);
+    void removeEdge(VertexId u, VertexId v);
 
     /**
      * @brief Removes all edges to/from a vertex.
      * @param v Vertex to remove
      */
-    void removeVertex(int v);
+    void removeVertex(VertexId v);
 
     /**
-     * @brief Checks if an edge exists from u to v.
+     * @brief Checks if an edge exists from u to v in expected O(1).
      * @return True if edge exists, false otherwise
      */
-    bool edgeExists(int u, int v);
+    bool edgeExists(VertexId u, VertexId v);
 
     /**
      * @brief Returns neighbors of a vertex.
      * @param u Vertex
      * @return Vector of neighbor vertex indices
      */
-    std::vector<int> getNeighbors(int u) const;
+    std::vector<VertexId> getNeighbors(VertexId u) const;
 
     /**
      * @brief Returns the out-degree of a vertex.
      * @param u Vertex
      * @return Number of outgoing edges
      */
-    int outDegree(int u);
+    int outDegree(VertexId u);
 
     /**
      * @brief Returns a new graph which is the transpose (reverse) of current graph.
      * @return Transposed Graph object
      */
-    Graph getTranspose();
+    BasicGraph getTranspose();
 
     /**
-     * @brief Clears the graph structure (adjacency list and matrix).
+     * @brief Clears the graph structure (adjacency list, edge set and matrix if built).
      */
     void clear();
 
@@ -201,68 +734,275 @@ public:
      */
     void makeUndirected();
 
+    /**
+     * @brief Returns the number of vertices.
+     */
+    VertexId numVertices() const;
+
+    /**
+     * @brief Returns every edge as a flat list, grouped by source vertex.
+     */
+    vector<EdgeType> getEdgeList() const;
+
+    /**
+     * @brief Returns the outgoing edges of a vertex without copying.
+     * @param u Vertex (must be in range)
+     * @return Reference to the {neighbor, weight} list of u
+     */
+    const vector<Entry>& adjacentEdges(VertexId u) const;
+
 };
 
+/**
+ * @brief The default graph: int vertex ids and int weights.
+ */
+using Graph = BasicGraph<int, int>;
+
+/**
+ * @brief Unweighted graph with 32-bit unsigned ids; adjacency entries are 4 bytes.
+ */
+using UnweightedGraph = BasicGraph<uint32_t, NoWeight>;
+
 // --- Method Implementations ---
 
-Graph::Graph(int vertices) {
+EdgeHashSet::EdgeHashSet() : count(0) {}
+
+uint64_t EdgeHashSet::pack(int u, int v) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(u)) << 32) | static_cast<uint32_t>(v);
+}
+
+uint64_t EdgeHashSet::mix(uint64_t key) {
+    // splitmix64 finalizer
+    key ^= key >> 30; key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27; key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+size_t EdgeHashSet::slotOf(uint64_t key) const {
+    size_t mask = slots.size() - 1;
+    size_t i = mix(key) & mask;
+    while (slots[i] != EMPTY && slots[i] != key)
+        i = (i + 1) & mask;
+    return i;
+}
+
+void EdgeHashSet::grow() {
+    vector<uint64_t> old;
+    old.swap(slots);
+    slots.assign(old.empty() ? 16 : old.size() * 2, EMPTY);
+    for (uint64_t key : old) {
+        if (key != EMPTY)
+            slots[slotOf(key)] = key;
+    }
+}
+
+void EdgeHashSet::insert(int u, int v) {
+    if ((count + 1) * 2 > slots.size()) grow(); // Keep load factor <= 0.5
+    uint64_t key = pack(u, v);
+    size_t i = slotOf(key);
+    if (slots[i] == EMPTY) {
+        slots[i] = key;
+        count++;
+    }
+}
+
+void EdgeHashSet::reserve(size_t n) {
+    while (n * 2 > slots.size()) grow();
+}
+
+void EdgeHashSet::erase(int u, int v) {
+    if (count == 0) return;
+    size_t mask = slots.size() - 1;
+    size_t i = slotOf(pack(u, v));
+    if (slots[i] == EMPTY) return;
+
+    // Backward-shift: pull later entries of the probe run into the hole.
+    size_t hole = i;
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & mask;
+        if (slots[j] == EMPTY) break;
+        size_t home = mix(slots[j]) & mask;
+        bool movable = (hole <= j) ? (home <= hole || home > j) : (home <= hole && home > j);
+        if (movable) {
+            slots[hole] = slots[j];
+            hole = j;
+        }
+    }
+    slots[hole] = EMPTY;
+    count--;
+}
+
+bool EdgeHashSet::contains(int u, int v) const {
+    if (count == 0) return false;
+    return slots[slotOf(pack(u, v))] != EMPTY;
+}
+
+size_t EdgeHashSet::size() const {
+    return count;
+}
+
+void EdgeHashSet::clear() {
+    slots.clear();
+    count = 0;
+}
+
+template <typename VertexId, typename Weight>
+BasicGraph<VertexId, Weight>::BasicGraph(VertexId vertices) {
     V = vertices;
     adjList.resize(V);
-    adjMatrix.resize(V, vector<int>(V, 0));
+    maxEdgeWeight = 0;
+    hasNegativeWeight = false;
+    sortedNeighbors = false;
 }
 
-void Graph::addEdge(int u, int v, int weight) {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::addEdge(VertexId u, VertexId v, Weight weight) {
     if (u >= V || v >= V) return;
-    adjList[u].push_back({v, weight});
-    adjMatrix[u][v] = weight;
+    if (sortedNeighbors) {
+        auto at = std::upper_bound(adjList[u].begin(), adjList[u].end(), v,
+                                   [](VertexId x, const Entry& edge) { return x < edge.first; });
+        adjList[u].insert(at, Entry(v, weight));
+    } else {
+        adjList[u].push_back(Entry(v, weight));
+    }
+    edgeSet.insert(u, v);
+    maxEdgeWeight = std::max(maxEdgeWeight, cost(weight));
+    if (cost(weight) < 0) hasNegativeWeight = true;
+    if (!adjMatrix.empty()) adjMatrix[u][v] = cost(weight);
 }
 
-void Graph::BFS(int start) {
-    vector<bool> visited(V, false);
-    queue<int> q;
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::addEdges(const vector<EdgeType>& edges) {
+    auto valid = [&](const EdgeType& e) { return e.u >= 0 && e.u < V && e.v >= 0 && e.v < V; };
+    vector<int> added(V, 0);
+    size_t total = 0;
+    for (const EdgeType& e : edges) {
+        if (!valid(e)) continue;
+        added[e.u]++;
+        total++;
+    }
+    for (VertexId u = 0; u < V; ++u) {
+        if (added[u] > 0) adjList[u].reserve(adjList[u].size() + added[u]);
+    }
+    edgeSet.reserve(edgeSet.size() + total);
+
+    for (const EdgeType& e : edges) {
+        if (!valid(e)) continue;
+        adjList[e.u].push_back(Entry(e.v, e.weight));
+        edgeSet.insert(e.u, e.v);
+        maxEdgeWeight = std::max(maxEdgeWeight, cost(e.weight));
+        if (cost(e.weight) < 0) hasNegativeWeight = true;
+        if (!adjMatrix.empty()) adjMatrix[e.u][e.v] = cost(e.weight);
+    }
 
-    visited[start] = true;
-    q.push(start);
+    if (sortedNeighbors) {
+        auto byNeighbor = [](const Entry& a, const Entry& b) { return a.first < b.first; };
+        for (VertexId u = 0; u < V; ++u) {
+            if (added[u] == 0) continue;
+            auto appended = adjList[u].end() - added[u];
+            std::stable_sort(appended, adjList[u].end(), byNeighbor);
+            std::inplace_merge(adjList[u].begin(), appended, adjList[u].end(), byNeighbor);
+        }
+    }
+}
 
-    cout << "BFS Traversal from " << start << ": ";
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::TraversalArena::reset(VertexId n) {
+    mark.assign(n, 0);
+    frames.clear();
+    order.clear();
+}
 
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
-        cout << u << " ";
+template <typename VertexId, typename Weight>
+template <typename Visitor>
+bool BasicGraph<VertexId, Weight>::breadthFirstVisit(VertexId start, Visitor&& visitor) {
+    if (start < 0 || start >= V) throw std::out_of_range("BFS start is not a vertex");
+    // mark: 0 = undiscovered, 1 = discovered, 2 = discovered but not to be expanded.
+    // arena.order is the queue; head walks it instead of popping.
+    arena.reset(V);
+    auto discover = [&](VertexId v) {
+        VisitAction action = visitStep([&] { return visitor.discoverVertex(v); });
+        arena.mark[v] = action == VisitAction::Skip ? 2 : 1;
+        arena.order.push_back(v);
+        return action != VisitAction::Stop;
+    };
+    if (!discover(start)) return false;
 
-        for (const auto& edge : adjList[u]) {
-            int v = edge.first;
-            if (!visited[v]) {
-                visited[v] = true;
-                q.push(v);
+    for (size_t head = 0; head < arena.order.size(); ++head) {
+        VertexId u = arena.order[head];
+        if (arena.mark[u] == 1) {
+            for (const auto& edge : adjList[u]) {
+                VisitAction action = visitStep([&] { return visitor.examineEdge(u, edge.first, edge.second); });
+                if (action == VisitAction::Stop) return false;
+                if (action == VisitAction::Continue && !arena.mark[edge.first] && !discover(edge.first))
+                    return false;
             }
         }
+        if (visitStep([&] { return visitor.finishVertex(u); }) == VisitAction::Stop) return false;
     }
-    cout << "\n";
+    return true;
 }
 
-void Graph::dfsUtil(int v, vector<bool>& visited) {
-    visited[v] = true;
-    cout << v << " ";
-
-    for (const auto& edge : adjList[v]) {
-        int u = edge.first;
-        if (!visited[u])
-            dfsUtil(u, visited);
+template <typename VertexId, typename Weight>
+template <typename Visitor>
+bool BasicGraph<VertexId, Weight>::depthFirstVisit(VertexId start, Visitor&& visitor) {
+    if (start < 0 || start >= V) throw std::out_of_range("DFS start is not a vertex");
+    arena.reset(V);
+    // A skipped vertex gets a frame that is already past its last edge.
+    auto discover = [&](VertexId v, VertexId parent) {
+        arena.mark[v] = 1;
+        VisitAction action = visitStep([&] { return visitor.discoverVertex(v); });
+        int firstEdge = action == VisitAction::Skip ? static_cast<int>(adjList[v].size()) : 0;
+        arena.frames.push_back({v, firstEdge, parent});
+        return action != VisitAction::Stop;
+    };
+    if (!discover(start, NO_VERTEX)) return false;
+
+    while (!arena.frames.empty()) {
+        DfsFrame& top = arena.frames.back();
+        const auto& edges = adjList[top.vertex];
+        if (top.edge == static_cast<int>(edges.size())) {
+            VertexId done = top.vertex;
+            arena.frames.pop_back();
+            if (visitStep([&] { return visitor.finishVertex(done); }) == VisitAction::Stop) return false;
+            continue;
+        }
+        VertexId u = top.vertex;
+        const Entry& edge = edges[top.edge++];
+        VisitAction action = visitStep([&] { return visitor.examineEdge(u, edge.first, edge.second); });
+        if (action == VisitAction::Stop) return false;
+        if (action == VisitAction::Continue && !arena.mark[edge.first] && !discover(edge.first, u))
+            return false;
     }
+    return true;
+}
+
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::BFS(VertexId start) {
+    cout << "BFS Traversal from " << start << ": ";
+    struct Printer : GraphVisitor<VertexId, Weight> {
+        void discoverVertex(VertexId v) { cout << v << " "; }
+    };
+    breadthFirstVisit(start, Printer());
+    cout << "\n";
 }
 
-void Graph::DFS(int start) {
-    vector<bool> visited(V, false);
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::DFS(VertexId start) {
     cout << "DFS Traversal from " << start << ": ";
-    dfsUtil(start, visited);
+    struct Printer : GraphVisitor<VertexId, Weight> {
+        void discoverVertex(VertexId v) { cout << v << " "; }
+    };
+    depthFirstVisit(start, Printer());
     cout << "\n";
 }
 
-void Graph::printAdjList() {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::printAdjList() {
     cout << "Adjacency List:\n";
-    for (int i = 0; i < V; ++i) {
+    for (VertexId i = 0; i < V; ++i) {
         cout << i << ": ";
         for (const auto& edge : adjList[i])
             cout << edge.first << "(w:" << edge.second << ") ";
@@ -270,162 +1010,614 @@ void Graph::printAdjList() {
     }
 }
 
-void Graph::printAdjMatrix() {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::printAdjMatrix() {
     cout << "Adjacency Matrix:\n";
-    for (int i = 0; i < V; ++i) {
-        for (int j = 0; j < V; ++j)
-            cout << adjMatrix[i][j] << " ";
+    vector<Distance> row(V, 0);
+    for (VertexId i = 0; i < V; ++i) {
+        for (const auto& edge : adjList[i])
+            row[edge.first] = cost(edge.second);
+        for (VertexId j = 0; j < V; ++j)
+            cout << row[j] << " ";
         cout << "\n";
+        for (const auto& edge : adjList[i])
+            row[edge.first] = 0;
+    }
+}
+
+template <typename VertexId, typename Weight>
+const vector<vector<typename BasicGraph<VertexId, Weight>::Distance>>& BasicGraph<VertexId, Weight>::getAdjMatrix() {
+    if (adjMatrix.empty() && V > 0) {
+        adjMatrix.assign(V, vector<Distance>(V, 0));
+        for (VertexId u = 0; u < V; ++u) {
+            for (const auto& edge : adjList[u])
+                adjMatrix[u][edge.first] = cost(edge.second);
+        }
     }
+    return adjMatrix;
 }
 
-vector<int> Graph::topologicalSort() {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::releaseAdjMatrix() {
+    vector<vector<Distance>>().swap(adjMatrix);
+}
+
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::hasAdjMatrix() const {
+    return !adjMatrix.empty();
+}
+
+template <typename VertexId, typename Weight>
+vector<VertexId> BasicGraph<VertexId, Weight>::topologicalSort() {
     vector<int> inDegree(V, 0);
-    for (int u = 0; u < V; ++u) {
+    for (VertexId u = 0; u < V; ++u) {
         for (const auto& edge : adjList[u]) {
             inDegree[edge.first]++;
         }
     }
 
-    queue<int> q;
-    for (int i = 0; i < V; ++i) {
+    queue<VertexId> q;
+    for (VertexId i = 0; i < V; ++i) {
         if (inDegree[i] == 0)
             q.push(i);
     }
 
-    vector<int> topo;
+    vector<VertexId> topo;
     while (!q.empty()) {
-        int u = q.front(); q.pop();
+        VertexId u = q.front(); q.pop();
         topo.push_back(u);
 
         for (const auto& edge : adjList[u]) {
-            int v = edge.first;
+            VertexId v = edge.first;
             if (--inDegree[v] == 0)
                 q.push(v);
         }
     }
 
-    return topo.size() == V ? topo : vector<int>(); // Return empty vector if cycle exists
+    return topo.size() == static_cast<size_t>(V) ? topo : vector<VertexId>(); // Return empty vector if cycle exists
 }
 
-// Helper for directed cycle detection
-bool dfsDirectedCycleUtil(int v, vector<bool>& visited, vector<bool>& recStack, const vector<vector<pair<int, int>>>& adj) {
-    visited[v] = true;
-    recStack[v] = true;
-
-    for (const auto& edge : adj[v]) {
-        int u = edge.first;
-        if (!visited[u]) {
-            if (dfsDirectedCycleUtil(u, visited, recStack, adj))
-                return true;
-        } else if (recStack[u]) {
-            return true;
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::dfsDirectedCycleUtil(VertexId v) {
+    arena.mark[v] = 1;
+    arena.frames.push_back({v, 0, NO_VERTEX});
+
+    while (!arena.frames.empty()) {
+        DfsFrame& top = arena.frames.back();
+        const auto& edges = adjList[top.vertex];
+        if (top.edge == static_cast<int>(edges.size())) {
+            arena.mark[top.vertex] = 2; // Leaves the recursion stack
+            arena.frames.pop_back();
+            continue;
+        }
+        VertexId u = edges[top.edge++].first;
+        if (arena.mark[u] == 0) {
+            arena.mark[u] = 1;
+            arena.frames.push_back({u, 0, top.vertex});
+        } else if (arena.mark[u] == 1) {
+            arena.frames.clear();
+            return true; // Back edge
         }
     }
-    recStack[v] = false;
     return false;
 }
 
-bool Graph::hasCycleDirected() {
-    vector<bool> visited(V, false);
-    vector<bool> recStack(V, false);
-    for (int i = 0; i < V; ++i) {
-        if (!visited[i] && dfsDirectedCycleUtil(i, visited, recStack, adjList))
+template <typename VertexId, typename Weight>
+BasicTopologicalLevels<VertexId, typename BasicGraph<VertexId, Weight>::Distance>
+BasicGraph<VertexId, Weight>::topologicalLevels(ThreadPool& pool) {
+    const int64_t GRAIN = 1024;
+    const Distance NO_PATH = numeric_limits<Distance>::lowest();
+    BasicTopologicalLevels<VertexId, Distance> result;
+    result.levelOf.assign(V, -1);
+    result.offsets.push_back(0);
+
+    std::vector<std::atomic<int>> inDegree(V); // Value-initialized to 0
+    std::vector<std::atomic<Distance>> longest(V);
+    vector<vector<VertexId>> ready(pool.size()); // Per-worker vertices of the next level
+
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t u = lo; u < hi; ++u)
+            for (const auto& edge : adjList[u])
+                inDegree[edge.first].fetch_add(1, std::memory_order_relaxed);
+    }, GRAIN);
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int worker) {
+        for (int64_t v = lo; v < hi; ++v) {
+            bool source = inDegree[v].load(std::memory_order_relaxed) == 0;
+            longest[v].store(source ? Distance(0) : NO_PATH, std::memory_order_relaxed);
+            if (source) ready[worker].push_back(static_cast<VertexId>(v));
+        }
+    }, GRAIN);
+
+    // Moves the ready vertices into a new level, sorted so the output does not depend on scheduling.
+    auto closeLevel = [&]() {
+        size_t begin = result.vertices.size();
+        for (auto& buffer : ready) {
+            result.vertices.insert(result.vertices.end(), buffer.begin(), buffer.end());
+            buffer.clear();
+        }
+        if (result.vertices.size() == begin) return false;
+        parallelSort(pool, result.vertices.begin() + begin, result.vertices.end(), std::less<VertexId>());
+        for (size_t i = begin; i < result.vertices.size(); ++i)
+            result.levelOf[result.vertices[i]] = result.count();
+        result.offsets.push_back(static_cast<int>(result.vertices.size()));
+        return true;
+    };
+
+    // Relaxed atomics suffice: the barrier at the end of each parallelFor
+    // publishes a level's updates before the next level reads them.
+    while (closeLevel()) {
+        int level = result.count() - 1;
+        pool.parallelFor(result.offsets[level], result.offsets[level + 1], [&](int64_t lo, int64_t hi, int worker) {
+            for (int64_t i = lo; i < hi; ++i) {
+                VertexId u = result.vertices[i];
+                Distance du = longest[u].load(std::memory_order_relaxed);
+                for (const auto& edge : adjList[u]) {
+                    VertexId v = edge.first;
+                    Distance candidate = du + cost(edge.second);
+                    Distance current = longest[v].load(std::memory_order_relaxed);
+                    while (candidate > current && !longest[v].compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+                    }
+                    if (inDegree[v].fetch_sub(1, std::memory_order_relaxed) == 1)
+                        ready[worker].push_back(v);
+                }
+            }
+        }, 64);
+    }
+
+    result.acyclic = result.vertices.size() == static_cast<size_t>(V);
+    if (!result.acyclic || V == 0) return result;
+
+    result.longestPathTo.resize(V);
+    for (VertexId v = 0; v < V; ++v)
+        result.longestPathTo[v] = longest[v].load(std::memory_order_relaxed);
+
+    // A predecessor of v on a heaviest path is any u whose edge reproduces v's value exactly.
+    std::vector<std::atomic<VertexId>> predecessor(V);
+    for (VertexId v = 0; v < V; ++v)
+        predecessor[v].store(NO_VERTEX, std::memory_order_relaxed);
+    const vector<Distance>& best = result.longestPathTo;
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t i = lo; i < hi; ++i) {
+            VertexId u = static_cast<VertexId>(i);
+            for (const auto& edge : adjList[u]) {
+                VertexId v = edge.first;
+                if (best[u] + cost(edge.second) != best[v]) continue;
+                VertexId current = predecessor[v].load(std::memory_order_relaxed);
+                while (u < current && !predecessor[v].compare_exchange_weak(current, u, std::memory_order_relaxed)) {
+                }
+            }
+        }
+    }, GRAIN);
+
+    VertexId sink = static_cast<VertexId>(std::max_element(best.begin(), best.end()) - best.begin());
+    result.criticalLength = best[sink];
+    for (VertexId v = sink; v != NO_VERTEX; v = predecessor[v].load(std::memory_order_relaxed))
+        result.criticalPath.push_back(v);
+    std::reverse(result.criticalPath.begin(), result.criticalPath.end());
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::hasCycleDirected() {
+    arena.reset(V);
+    for (VertexId i = 0; i < V; ++i) {
+        if (!arena.mark[i] && dfsDirectedCycleUtil(i))
             return true;
     }
     return false;
 }
 
-// Helper for undirected cycle detection
-bool dfsUndirectedCycleUtil(int v, int parent, vector<bool>& visited, const vector<vector<pair<int, int>>>& adj) {
-    visited[v] = true;
-    for (const auto& edge : adj[v]) {
-        int u = edge.first;
-        if (!visited[u]) {
-            if (dfsUndirectedCycleUtil(u, v, visited, adj))
-                return true;
-        } else if (u != parent) {
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::dfsUndirectedCycleUtil(VertexId v) {
+    arena.mark[v] = 1;
+    arena.frames.push_back({v, 0, NO_VERTEX});
+
+    while (!arena.frames.empty()) {
+        DfsFrame& top = arena.frames.back();
+        const auto& edges = adjList[top.vertex];
+        if (top.edge == static_cast<int>(edges.size())) {
+            arena.frames.pop_back();
+            continue;
+        }
+        VertexId u = edges[top.edge++].first;
+        if (!arena.mark[u]) {
+            arena.mark[u] = 1;
+            arena.frames.push_back({u, 0, top.vertex});
+        } else if (u != top.parent) {
+            arena.frames.clear();
             return true;
         }
     }
     return false;
 }
 
-bool Graph::hasCycleUndirected() {
-    vector<bool> visited(V, false);
-    for (int i = 0; i < V; ++i) {
-        if (!visited[i] && dfsUndirectedCycleUtil(i, -1, visited, adjList))
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::hasCycleUndirected() {
+    arena.reset(V);
+    for (VertexId i = 0; i < V; ++i) {
+        if (!arena.mark[i] && dfsUndirectedCycleUtil(i))
             return true;
     }
     return false;
 }
 
-int Graph::countConnectedComponents() {
-    vector<bool> visited(V, false);
+template <typename VertexId, typename Weight>
+int BasicGraph<VertexId, Weight>::countConnectedComponents() {
+    arena.reset(V);
     int count = 0;
 
-    function<void(int)> dfs = [&](int u) {
-        visited[u] = true;
-        for (const auto& edge : adjList[u]) {
-            if (!visited[edge.first]) {
-                dfs(edge.first);
+    for (VertexId i = 0; i < V; ++i) {
+        if (arena.mark[i]) continue;
+        count++;
+
+        // Plain stack flood fill: only reachability matters here, not DFS order.
+        arena.mark[i] = 1;
+        arena.order.push_back(i);
+        while (!arena.order.empty()) {
+            VertexId u = arena.order.back();
+            arena.order.pop_back();
+            for (const auto& edge : adjList[u]) {
+                if (!arena.mark[edge.first]) {
+                    arena.mark[edge.first] = 1;
+                    arena.order.push_back(edge.first);
+                }
             }
         }
+    }
+    return count;
+}
+
+template <typename VertexId, typename Weight>
+vector<VertexId> BasicGraph<VertexId, Weight>::connectedComponents(ThreadPool& pool) {
+    const int NEIGHBOR_ROUNDS = 2;    // Edges per vertex linked before sampling
+    const int SAMPLES = 1024;         // Vertices sampled to find the largest component
+    const int64_t GRAIN = 1024;
+    std::vector<std::atomic<VertexId>> comp(V);
+    for (VertexId v = 0; v < V; ++v)
+        comp[v].store(v, std::memory_order_relaxed);
+
+    // Hooks the larger of the two roots under the smaller, retrying if another
+    // thread changed either root in between.
+    auto link = [&](VertexId u, VertexId v) {
+        VertexId p1 = comp[u].load(std::memory_order_relaxed);
+        VertexId p2 = comp[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            VertexId high = std::max(p1, p2);
+            VertexId low = std::min(p1, p2);
+            VertexId parentOfHigh = comp[high].load(std::memory_order_relaxed);
+            if (parentOfHigh == low) break;
+            if (parentOfHigh == high && comp[high].compare_exchange_strong(parentOfHigh, low, std::memory_order_relaxed))
+                break;
+            p1 = comp[comp[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = comp[low].load(std::memory_order_relaxed);
+        }
     };
+    auto compress = [&]() {
+        pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+            for (int64_t v = lo; v < hi; ++v) {
+                VertexId parent = comp[v].load(std::memory_order_relaxed);
+                VertexId grand = comp[parent].load(std::memory_order_relaxed);
+                while (parent != grand) {
+                    comp[v].store(grand, std::memory_order_relaxed);
+                    parent = grand;
+                    grand = comp[parent].load(std::memory_order_relaxed);
+                }
+            }
+        }, GRAIN);
+    };
+
+    for (int round = 0; round < NEIGHBOR_ROUNDS; ++round) {
+        pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+            for (int64_t u = lo; u < hi; ++u) {
+                if (round < static_cast<int>(adjList[u].size()))
+                    link(static_cast<VertexId>(u), adjList[u][round].first);
+            }
+        }, GRAIN);
+        compress();
+    }
 
-    for (int i = 0; i < V; ++i) {
-        if (!visited[i]) {
-            dfs(i);
-            count++;
+    // Most frequent label in a sample: likely the giant component, which is now mostly complete.
+    VertexId giant = 0;
+    if (V > 0) {
+        std::mt19937 rng(V);
+        std::unordered_map<VertexId, int> frequency;
+        int best = 0;
+        for (int i = 0; i < SAMPLES; ++i) {
+            VertexId label = comp[rng() % static_cast<uint64_t>(V)].load(std::memory_order_relaxed);
+            int seen = ++frequency[label];
+            if (seen > best) {
+                best = seen;
+                giant = label;
+            }
         }
     }
-    return count;
+
+    // Remaining edges. A giant-component vertex only needs a link when its
+    // neighbor is outside (possible for directed edges, whose reverse is absent).
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t u = lo; u < hi; ++u) {
+            const auto& edges = adjList[u];
+            bool inGiant = comp[u].load(std::memory_order_relaxed) == giant;
+            for (size_t e = NEIGHBOR_ROUNDS; e < edges.size(); ++e) {
+                VertexId v = edges[e].first;
+                if (inGiant && comp[v].load(std::memory_order_relaxed) == giant) continue;
+                link(static_cast<VertexId>(u), v);
+            }
+        }
+    }, GRAIN);
+    compress();
+
+    vector<VertexId> labels(V);
+    for (VertexId v = 0; v < V; ++v)
+        labels[v] = comp[v].load(std::memory_order_relaxed);
+    return labels;
 }
 
-bool Graph::isBipartite() {
-    vector<int> color(V, -1); // -1: no color, 0: color 1, 1: color 2
-    queue<int> q;
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::isBipartite() {
+    return bipartition().bipartite;
+}
 
-    for (int i = 0; i < V; ++i) {
-        if (color[i] == -1) {
-            color[i] = 0;
-            q.push(i);
+template <typename VertexId, typename Weight>
+Bipartition BasicGraph<VertexId, Weight>::bipartition() const {
+    const char UNCOLORED = 2;
+    // Undirected CSR: both endpoints of every edge list each other.
+    vector<size_t> start(static_cast<size_t>(V) + 1, 0);
+    for (VertexId u = 0; u < V; ++u) {
+        for (const auto& edge : adjList[u]) {
+            start[u + 1]++;
+            start[edge.first + 1]++;
+        }
+    }
+    for (VertexId v = 0; v < V; ++v) start[v + 1] += start[v];
+    vector<VertexId> neighbors(start[V]);
+    vector<size_t> fill(start.begin(), start.end() - 1);
+    for (VertexId u = 0; u < V; ++u) {
+        for (const auto& edge : adjList[u]) {
+            neighbors[fill[u]++] = edge.first;
+            neighbors[fill[edge.first]++] = u;
+        }
+    }
 
-            while (!q.empty()) {
-                int u = q.front(); q.pop();
-                for (const auto& edge : adjList[u]) {
-                    int v = edge.first;
-                    if (color[v] == -1) {
-                        color[v] = 1 - color[u];
-                        q.push(v);
-                    } else if (color[v] == color[u]) {
-                        return false; // Not bipartite
-                    }
+    Bipartition result;
+    result.side.assign(V, UNCOLORED);
+    vector<VertexId> order; // BFS queue
+    order.reserve(V);
+    for (VertexId root = 0; root < V; ++root) {
+        if (result.side[root] != UNCOLORED) continue;
+        result.side[root] = 0;
+        order.push_back(root);
+        for (size_t head = order.size() - 1; head < order.size(); ++head) {
+            VertexId u = order[head];
+            for (size_t i = start[u]; i < start[u + 1]; ++i) {
+                VertexId v = neighbors[i];
+                if (result.side[v] == UNCOLORED) {
+                    result.side[v] = 1 - result.side[u];
+                    order.push_back(v);
+                } else if (result.side[v] == result.side[u]) {
+                    result.bipartite = false;
+                    return result;
                 }
             }
         }
     }
-    return true;
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::sortNeighbors(ThreadPool& pool) {
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t u = lo; u < hi; ++u) {
+            std::stable_sort(adjList[u].begin(), adjList[u].end(),
+                             [](const Entry& a, const Entry& b) { return a.first < b.first; });
+        }
+    }, 256);
+    sortedNeighbors = true;
+}
+
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::hasSortedNeighbors() const {
+    return sortedNeighbors;
+}
+
+template <typename VertexId, typename Weight>
+int64_t BasicGraph<VertexId, Weight>::countCommon(const Entry* a, const Entry* aEnd, const Entry* b, const Entry* bEnd) {
+    if (aEnd - a > bEnd - b) {
+        std::swap(a, b);
+        std::swap(aEnd, bEnd);
+    }
+    int64_t common = 0;
+
+    if (bEnd - b < (aEnd - a) * GALLOP_RATIO) {
+        while (a < aEnd && b < bEnd) {
+            if (a->first < b->first) {
+                ++a;
+            } else if (b->first < a->first) {
+                ++b;
+            } else {
+                VertexId x = a->first;
+                common++;
+                while (a < aEnd && a->first == x) ++a; // Parallel edges count once
+                while (b < bEnd && b->first == x) ++b;
+            }
+        }
+        return common;
+    }
+
+    for (; a < aEnd && b < bEnd; ++a) {
+        VertexId x = a->first;
+        if (a + 1 < aEnd && a[1].first == x) continue; // Handle each distinct value once
+
+        // Exponential search: b[lo - 1] < x <= b[hi] (or hi == n).
+        ptrdiff_t n = bEnd - b;
+        ptrdiff_t hi = 1;
+        while (hi < n && b[hi - 1].first < x) hi *= 2;
+        ptrdiff_t lo = hi / 2;
+        hi = std::min(hi, n);
+        while (hi - lo > GALLOP_BLOCK) {
+            ptrdiff_t mid = lo + (hi - lo) / 2;
+            if (b[mid].first < x) lo = mid + 1;
+            else hi = mid;
+        }
+        ptrdiff_t below = 0;
+        for (ptrdiff_t i = lo; i < hi; ++i)
+            below += b[i].first < x;
+        b += lo + below;
+        if (b < bEnd && b->first == x) common++;
+    }
+    return common;
+}
+
+template <typename VertexId, typename Weight>
+const typename BasicGraph<VertexId, Weight>::Entry* BasicGraph<VertexId, Weight>::firstAbove(VertexId u, VertexId x) const {
+    const Entry* begin = adjList[u].data();
+    return std::upper_bound(begin, begin + adjList[u].size(), x,
+                            [](VertexId value, const Entry& edge) { return value < edge.first; });
+}
+
+template <typename VertexId, typename Weight>
+int64_t BasicGraph<VertexId, Weight>::countTriangles(ThreadPool& pool) {
+    if (!sortedNeighbors) sortNeighbors(pool);
+    vector<int64_t> perWorker(pool.size(), 0);
+
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int worker) {
+        int64_t found = 0;
+        for (int64_t i = lo; i < hi; ++i) {
+            VertexId u = static_cast<VertexId>(i);
+            const Entry* end = adjList[u].data() + adjList[u].size();
+            for (const Entry* p = firstAbove(u, u); p < end; ++p) {
+                VertexId v = p->first;
+                if (p + 1 < end && p[1].first == v) continue; // Last copy of a parallel edge
+                const Entry* vEnd = adjList[v].data() + adjList[v].size();
+                found += countCommon(p + 1, end, firstAbove(v, v), vEnd);
+            }
+        }
+        perWorker[worker] += found;
+    }, 64);
+
+    int64_t total = 0;
+    for (int64_t count : perWorker) total += count;
+    return total;
+}
+
+template <typename VertexId, typename Weight>
+vector<int64_t> BasicGraph<VertexId, Weight>::triangleCounts(ThreadPool& pool) {
+    if (!sortedNeighbors) sortNeighbors(pool);
+    vector<int64_t> triangles(V, 0);
+    auto hasSelfLoop = [&](VertexId v) {
+        const Entry* p = firstAbove(v, v);
+        return p != adjList[v].data() && p[-1].first == v;
+    };
+
+    pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+        for (int64_t i = lo; i < hi; ++i) {
+            VertexId u = static_cast<VertexId>(i);
+            const Entry* begin = adjList[u].data();
+            const Entry* end = begin + adjList[u].size();
+            int64_t uLoop = hasSelfLoop(u);
+            int64_t pairs = 0;
+            for (const Entry* p = begin; p < end; ++p) {
+                VertexId v = p->first;
+                if (v == u || (p + 1 < end && p[1].first == v)) continue;
+                const Entry* vBegin = adjList[v].data();
+                // Common neighbors other than u and v themselves (present only via self-loops).
+                pairs += countCommon(begin, end, vBegin, vBegin + adjList[v].size()) - uLoop - hasSelfLoop(v);
+            }
+            triangles[u] = pairs / 2; // Each triangle {u, v, w} is seen from v and from w
+        }
+    }, 64);
+    return triangles;
 }
 
-vector<int> Graph::dijkstra(int start) {
-    vector<int> dist(V, INF);
+template <typename VertexId, typename Weight>
+vector<double> BasicGraph<VertexId, Weight>::clusteringCoefficients(ThreadPool& pool) {
+    vector<int64_t> triangles = triangleCounts(pool);
+    vector<double> coefficient(V, 0.0);
+    for (VertexId u = 0; u < V; ++u) {
+        int64_t degree = 0;
+        const auto& edges = adjList[u];
+        for (size_t i = 0; i < edges.size(); ++i)
+            degree += edges[i].first != u && (i + 1 == edges.size() || edges[i + 1].first != edges[i].first);
+        if (degree >= 2)
+            coefficient[u] = 2.0 * triangles[u] / (static_cast<double>(degree) * (degree - 1));
+    }
+    return coefficient;
+}
+
+template <typename VertexId, typename Weight>
+vector<int> BasicGraph<VertexId, Weight>::coreNumbers() {
+    if (!sortedNeighbors) sortNeighbors();
+    // Calls visit(w) once per distinct neighbor w != u.
+    auto forNeighbors = [&](VertexId u, auto visit) {
+        const auto& edges = adjList[u];
+        for (size_t i = 0; i < edges.size(); ++i) {
+            VertexId w = edges[i].first;
+            if (w != u && (i + 1 == edges.size() || edges[i + 1].first != w)) visit(w);
+        }
+    };
+
+    vector<int> degree(V, 0);
+    int maxDegree = 0;
+    for (VertexId u = 0; u < V; ++u) {
+        forNeighbors(u, [&](VertexId) { degree[u]++; });
+        maxDegree = std::max(maxDegree, degree[u]);
+    }
+
+    // Counting sort by degree: vertices in vert, bucket d starting at bucketStart[d].
+    vector<int> bucketStart(maxDegree + 2, 0);
+    for (VertexId v = 0; v < V; ++v) bucketStart[degree[v] + 1]++;
+    for (int d = 0; d <= maxDegree; ++d) bucketStart[d + 1] += bucketStart[d];
+    vector<VertexId> vert(V);
+    vector<int> pos(V);
+    {
+        vector<int> cursor(bucketStart.begin(), bucketStart.end() - 1);
+        for (VertexId v = 0; v < V; ++v) {
+            pos[v] = cursor[degree[v]]++;
+            vert[pos[v]] = v;
+        }
+    }
+
+    for (int i = 0; i < static_cast<int>(V); ++i) {
+        VertexId v = vert[i];
+        forNeighbors(v, [&](VertexId w) {
+            if (degree[w] <= degree[v]) return;
+            // Swap w with the first vertex of its bucket, then shrink the bucket past it.
+            int dw = degree[w];
+            int first = bucketStart[dw];
+            VertexId head = vert[first];
+            if (head != w) {
+                std::swap(vert[first], vert[pos[w]]);
+                pos[head] = pos[w];
+                pos[w] = first;
+            }
+            bucketStart[dw]++;
+            degree[w]--;
+        });
+    }
+    return degree;
+}
+
+template <typename VertexId, typename Weight>
+vector<typename BasicGraph<VertexId, Weight>::Distance> BasicGraph<VertexId, Weight>::dijkstra(VertexId start) {
+    const Distance INFINITE = infinity();
+    vector<Distance> dist(V, INFINITE);
     dist[start] = 0;
 
-    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    using Item = pair<Distance, VertexId>;
+    priority_queue<Item, vector<Item>, greater<Item>> pq;
     pq.push({0, start}); // {distance, vertex}
 
     while (!pq.empty()) {
-        int u = pq.top().second;
-        int d = pq.top().first;
+        VertexId u = pq.top().second;
+        Distance d = pq.top().first;
         pq.pop();
 
         if (d > dist[u]) continue;
 
         for (const auto& edge : adjList[u]) {
-            int v = edge.first;
-            int weight = edge.second;
-            if (dist[u] != INF && dist[u] + weight < dist[v]) {
+            VertexId v = edge.first;
+            Distance weight = cost(edge.second);
+            if (dist[u] != INFINITE && dist[u] + weight < dist[v]) {
                 dist[v] = dist[u] + weight;
                 pq.push({dist[v], v});
             }
@@ -434,28 +1626,78 @@ vector<int> Graph::dijkstra(int start) {
     return dist;
 }
 
-std::pair<std::vector<int>, bool> Graph::bellmanFord(int start) {
-    std::vector<int> dist(V, INF);
+template <typename VertexId, typename Weight>
+vector<typename BasicGraph<VertexId, Weight>::Distance> BasicGraph<VertexId, Weight>::dialDijkstra(VertexId start) {
+    if constexpr (!std::is_integral<Distance>::value) {
+        return dijkstra(start);
+    } else {
+        if (hasNegativeWeight || maxEdgeWeight > DIAL_MAX_WEIGHT)
+            return dijkstra(start);
+
+        vector<Distance> dist(V, infinity());
+        if (start >= V) return dist;
+
+        // Tentative distances in flight span at most maxEdgeWeight + 1 consecutive values,
+        // so bucket d % numBuckets never mixes two distances.
+        int numBuckets = static_cast<int>(maxEdgeWeight) + 1;
+        if (static_cast<int>(dialBuckets.size()) < numBuckets)
+            dialBuckets.resize(numBuckets);
+
+        dist[start] = 0;
+        dialBuckets[0].push_back(start);
+        int64_t pending = 1;
+
+        for (Distance d = 0; pending > 0; ++d) {
+            vector<VertexId>& bucket = dialBuckets[d % numBuckets];
+            // Index loop: zero-weight edges append to the bucket being scanned.
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                VertexId u = bucket[i];
+                pending--;
+                if (dist[u] != d) continue; // Stale entry
+
+                for (const auto& edge : adjList[u]) {
+                    VertexId v = edge.first;
+                    Distance nd = d + cost(edge.second);
+                    if (nd < dist[v]) {
+                        dist[v] = nd;
+                        dialBuckets[nd % numBuckets].push_back(v);
+                        pending++;
+                    }
+                }
+            }
+            bucket.clear(); // Keeps capacity for the next call
+        }
+        return dist;
+    }
+}
+
+template <typename VertexId, typename Weight>
+std::pair<std::vector<typename BasicGraph<VertexId, Weight>::Distance>, bool> BasicGraph<VertexId, Weight>::bellmanFord(VertexId start) {
+    const Distance INFINITE = infinity();
+    std::vector<Distance> dist(V, INFINITE);
     dist[start] = 0;
 
-    for (int i = 1; i < V; ++i) {
-        for (int u = 0; u < V; ++u) {
+    for (VertexId i = 1; i < V; ++i) {
+        bool changed = false;
+        for (VertexId u = 0; u < V; ++u) {
             for (const auto& edge : adjList[u]) {
-                int v = edge.first;
-                int weight = edge.second;
-                if (dist[u] != INF && dist[u] + weight < dist[v]) {
+                VertexId v = edge.first;
+                Distance weight = cost(edge.second);
+                if (dist[u] != INFINITE && dist[u] + weight < dist[v]) {
                     dist[v] = dist[u] + weight;
+                    changed = true;
                 }
             }
         }
+        if (!changed) return {dist, false}; // Converged: no negative cycle is reachable
     }
 
     // Check for negative-weight cycle
-    for (int u = 0; u < V; ++u) {
+    for (VertexId u = 0; u < V; ++u) {
         for (const auto& edge : adjList[u]) {
-            int v = edge.first;
-            int weight = edge.second;
-            if (dist[u] != INF && dist[u] + weight < dist[v]) {
+            VertexId v = edge.first;
+            Distance weight = cost(edge.second);
+            if (dist[u] != INFINITE && dist[u] + weight < dist[v]) {
                 return {dist, true}; // Negative cycle exists
             }
         }
@@ -464,19 +1706,97 @@ std::pair<std::vector<int>, bool> Graph::bellmanFord(int start) {
     return {dist, false};
 }
 
-int Graph::primMST() {
-    std::vector<int> key(V, INF);
+template <typename VertexId, typename Weight>
+std::pair<std::vector<typename BasicGraph<VertexId, Weight>::Distance>, bool> BasicGraph<VertexId, Weight>::spfa(VertexId start) {
+    std::vector<Distance> dist(V, infinity());
+    if (start >= V) return {dist, false};
+    std::vector<int> hops(V, 0);       // Edges on the current best path
+    std::vector<char> inQueue(V, 0);
+    queue<VertexId> q;
+
+    dist[start] = 0;
+    q.push(start);
+    inQueue[start] = 1;
+
+    while (!q.empty()) {
+        VertexId u = q.front(); q.pop();
+        inQueue[u] = 0;
+
+        for (const auto& edge : adjList[u]) {
+            VertexId v = edge.first;
+            if (dist[u] + cost(edge.second) < dist[v]) {
+                dist[v] = dist[u] + cost(edge.second);
+                hops[v] = hops[u] + 1;
+                if (hops[v] >= static_cast<int64_t>(V)) return {dist, true}; // Path repeats a vertex: negative cycle
+                if (!inQueue[v]) {
+                    inQueue[v] = 1;
+                    q.push(v);
+                }
+            }
+        }
+    }
+    return {dist, false};
+}
+
+template <typename VertexId, typename Weight>
+std::pair<std::vector<typename BasicGraph<VertexId, Weight>::Distance>, bool>
+BasicGraph<VertexId, Weight>::parallelBellmanFord(VertexId start, ThreadPool& pool) {
+    const Distance INFINITE = infinity();
+    std::vector<Distance> result(V, INFINITE);
+    if (start >= V) return {result, false};
+
+    vector<EdgeType> edges = getEdgeList();
+    std::vector<std::atomic<Distance>> dist(V);
+    for (VertexId v = 0; v < V; ++v)
+        dist[v].store(INFINITE, std::memory_order_relaxed);
+    dist[start].store(0, std::memory_order_relaxed);
+
+    // One round over all edges; returns true if any distance decreased.
+    auto relaxRound = [&]() {
+        std::atomic<bool> changed(false);
+        pool.parallelFor(0, static_cast<int64_t>(edges.size()), [&](int64_t lo, int64_t hi, int) {
+            bool localChange = false;
+            for (int64_t i = lo; i < hi; ++i) {
+                Distance du = dist[edges[i].u].load(std::memory_order_relaxed);
+                if (du == INFINITE) continue;
+                Distance candidate = du + cost(edges[i].weight);
+                std::atomic<Distance>& dv = dist[edges[i].v];
+                Distance current = dv.load(std::memory_order_relaxed);
+                while (candidate < current && !dv.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+                }
+                if (candidate < current) localChange = true;
+            }
+            if (localChange) changed.store(true, std::memory_order_relaxed);
+        }, 4096);
+        return changed.load();
+    };
+
+    bool converged = false;
+    for (VertexId i = 1; i < V && !converged; ++i)
+        converged = !relaxRound();
+
+    // A round after V - 1 that still improves something proves a negative cycle.
+    bool negativeCycle = !converged && relaxRound();
+
+    for (VertexId v = 0; v < V; ++v)
+        result[v] = dist[v].load(std::memory_order_relaxed);
+    return {result, negativeCycle};
+}
+
+template <typename VertexId, typename Weight>
+typename BasicGraph<VertexId, Weight>::Distance BasicGraph<VertexId, Weight>::primMST() {
+    std::vector<Distance> key(V, infinity());
     std::vector<bool> inMST(V, false);
     key[0] = 0;
 
-    using pii = std::pair<int, int>;
-    std::priority_queue<pii, std::vector<pii>, std::greater<pii>> pq; // {key, vertex}
+    using Item = std::pair<Distance, VertexId>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> pq; // {key, vertex}
     pq.push({0, 0});
 
-    int totalWeight = 0;
+    Distance totalWeight = 0;
 
     while (!pq.empty()) {
-        int u = pq.top().second;
+        VertexId u = pq.top().second;
         pq.pop();
 
         if (inMST[u]) continue;
@@ -484,8 +1804,8 @@ int Graph::primMST() {
         totalWeight += key[u];
 
         for (const auto& edge : adjList[u]) {
-            int v = edge.first;
-            int weight = edge.second;
+            VertexId v = edge.first;
+            Distance weight = cost(edge.second);
             if (!inMST[v] && weight < key[v]) {
                 key[v] = weight;
                 pq.push({key[v], v});
@@ -495,75 +1815,244 @@ int Graph::primMST() {
     return totalWeight;
 }
 
-// Helper for getSCCs: Fill stack with vertices in order of finishing times
-void dfsFillOrder(int u, std::vector<bool>& visited, std::stack<int>& Stack, const std::vector<std::vector<pair<int, int>>>& adj) {
-    visited[u] = true;
-    for (const auto& edge : adj[u]) {
-        if (!visited[edge.first]) {
-            dfsFillOrder(edge.first, visited, Stack, adj);
-        }
+template <typename VertexId, typename Weight>
+vector<typename BasicGraph<VertexId, Weight>::EdgeType> BasicGraph<VertexId, Weight>::kruskalMST(ThreadPool& pool) {
+    vector<EdgeType> edges = getEdgeList();
+    parallelSort(pool, edges.begin(), edges.end(), [](const EdgeType& a, const EdgeType& b) {
+        if (cost(a.weight) != cost(b.weight)) return cost(a.weight) < cost(b.weight);
+        if (a.u != b.u) return a.u < b.u;
+        return a.v < b.v;
+    });
+
+    DisjointSet dsu(V);
+    vector<EdgeType> forest;
+    for (const EdgeType& e : edges) {
+        if (static_cast<int64_t>(forest.size()) == static_cast<int64_t>(V) - 1) break;
+        if (dsu.unionBySize(e.u, e.v))
+            forest.push_back(e);
     }
-    Stack.push(u);
+    return forest;
 }
 
-// Helper for getSCCs: Collect all reachable vertices for a component
-void dfsCollect(int u, std::vector<bool>& visited, std::vector<int>& component, const Graph& revGraph) {
-    visited[u] = true;
-    component.push_back(u);
-    for (int v : revGraph.getNeighbors(u)) {
-        if (!visited[v]) {
-            dfsCollect(v, visited, component, revGraph);
-        }
+template <typename VertexId, typename Weight>
+vector<typename BasicGraph<VertexId, Weight>::EdgeType> BasicGraph<VertexId, Weight>::boruvkaMST(ThreadPool& pool) {
+    const uint64_t NONE = ~0ULL;
+    const int64_t GRAIN = 4096;
+    vector<EdgeType> edges = getEdgeList();
+    vector<EdgeType> remaining; // Scratch for the contracted edge list
+    vector<EdgeType> forest;
+    vector<VertexId> comp(V);          // Root of each vertex's component
+    vector<uint64_t> chosen(V, NONE);  // Forest edge contributed by each root this round
+    std::vector<std::atomic<VertexId>> parent(V);
+    std::vector<std::atomic<uint64_t>> cheapest(V);
+    for (VertexId v = 0; v < V; ++v) {
+        comp[v] = v;
+        parent[v].store(v, std::memory_order_relaxed);
     }
-}
-
 
-std::vector<std::vector<int>> Graph::getSCCs() {
-    std::stack<int> Stack;
-    std::vector<bool> visited(V, false);
+    // Orders edges by weight, then by index, giving a strict total order.
+    auto lighter = [&](uint64_t a, uint64_t b) {
+        Distance wa = cost(edges[a].weight), wb = cost(edges[b].weight);
+        return wa < wb || (wa == wb && a < b);
+    };
+    auto forVertices = [&](auto body) {
+        pool.parallelFor(0, static_cast<int64_t>(V), [&](int64_t lo, int64_t hi, int) {
+            for (int64_t v = lo; v < hi; ++v) body(static_cast<VertexId>(v));
+        }, GRAIN);
+    };
+    // Appends item(i) for every i in [0, n) with keep(i) to out, in order: each
+    // block counts its survivors, a prefix sum gives its first slot, then it scatters.
+    auto compactInto = [&](size_t n, auto keep, auto item, vector<EdgeType>& out) {
+        const int64_t blocks = std::max<int64_t>(1, std::min<int64_t>(static_cast<int64_t>(pool.size()) * 4,
+                                                                      static_cast<int64_t>(n) / GRAIN));
+        auto blockBegin = [&](int64_t b) { return static_cast<size_t>(n * b / blocks); };
+        vector<size_t> slot(blocks + 1, 0);
+        pool.parallelFor(0, blocks, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t b = lo; b < hi; ++b)
+                for (size_t i = blockBegin(b); i < blockBegin(b + 1); ++i)
+                    slot[b + 1] += keep(i);
+        }, 1);
+        for (int64_t b = 0; b < blocks; ++b) slot[b + 1] += slot[b];
+        size_t base = out.size();
+        out.resize(base + slot[blocks]);
+        pool.parallelFor(0, blocks, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t b = lo; b < hi; ++b) {
+                size_t next = base + slot[b];
+                for (size_t i = blockBegin(b); i < blockBegin(b + 1); ++i)
+                    if (keep(i)) out[next++] = item(i);
+            }
+        }, 1);
+        return slot[blocks];
+    };
 
-    // 1. Fill stack with vertices based on finishing times
-    for (int i = 0; i < V; ++i) {
-        if (!visited[i]) {
-            dfsFillOrder(i, visited, Stack, adjList);
-        }
+    while (!edges.empty()) {
+        forVertices([&](VertexId v) { cheapest[v].store(NONE, std::memory_order_relaxed); });
+        pool.parallelFor(0, static_cast<int64_t>(edges.size()), [&](int64_t lo, int64_t hi, int) {
+            for (int64_t i = lo; i < hi; ++i) {
+                VertexId cu = comp[edges[i].u], cv = comp[edges[i].v];
+                if (cu == cv) continue;
+                uint64_t index = static_cast<uint64_t>(i);
+                for (VertexId c : {cu, cv}) {
+                    uint64_t current = cheapest[c].load(std::memory_order_relaxed);
+                    while ((current == NONE || lighter(index, current)) &&
+                           !cheapest[c].compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+                    }
+                }
+            }
+        }, GRAIN);
+
+        // Hook every root to the component across its lightest edge. With a strict
+        // edge order the only cycles are pairs sharing one edge; the smaller root of
+        // such a pair stays a root and records the edge, so it is added once.
+        forVertices([&](VertexId c) {
+            chosen[c] = NONE;
+            uint64_t index = cheapest[c].load(std::memory_order_relaxed);
+            if (comp[c] != c || index == NONE) return;
+            const EdgeType& e = edges[static_cast<size_t>(index)];
+            VertexId other = comp[e.u] == c ? comp[e.v] : comp[e.u];
+            bool mutual = cheapest[other].load(std::memory_order_relaxed) == index;
+            if (!mutual || c < other) chosen[c] = index;
+            if (!mutual || c > other) parent[c].store(other, std::memory_order_relaxed);
+        });
+        size_t added = compactInto(static_cast<size_t>(V),
+                                   [&](size_t c) { return chosen[c] != NONE; },
+                                   [&](size_t c) { return edges[static_cast<size_t>(chosen[c])]; }, forest);
+        if (added == 0) break;
+
+        // Pointer jumping (with path halving) from each vertex's old root to its new one.
+        forVertices([&](VertexId v) {
+            VertexId root = comp[v];
+            VertexId up = parent[root].load(std::memory_order_relaxed);
+            while (up != root) {
+                VertexId above = parent[up].load(std::memory_order_relaxed);
+                if (above != up) parent[root].store(above, std::memory_order_relaxed);
+                root = up;
+                up = above;
+            }
+            comp[v] = root;
+        });
+
+        // Contract: keep only edges that still join two different components.
+        remaining.clear();
+        compactInto(edges.size(),
+                    [&](size_t i) { return comp[edges[i].u] != comp[edges[i].v]; },
+                    [&](size_t i) { return edges[i]; }, remaining);
+        edges.swap(remaining);
     }
+    return forest;
+}
 
-    // 2. Get the transposed graph
-    Graph transposedGraph = getTranspose();
+template <typename VertexId, typename Weight>
+BasicSCCResult<VertexId> BasicGraph<VertexId, Weight>::getSCCsFlat() {
+    // Pearce's PEA_FIND_SCC2: rindex holds the DFS index while a vertex is active
+    // and the (descending) component number once it is assigned, so active and
+    // finished vertices never compare as "lower" than each other.
+    arena.reset(V);
+    vector<int>& rindex = arena.number;
+    rindex.assign(V, 0);
+    vector<char>& isRoot = arena.mark;
+    vector<VertexId>& pending = arena.order; // Visited vertices not yet in a component
+    int index = 1;
+    int component = static_cast<int>(V) - 1;
+
+    auto beginVisit = [&](VertexId v) {
+        isRoot[v] = 1;
+        rindex[v] = index++;
+        arena.frames.push_back({v, 0, NO_VERTEX});
+    };
+    auto finishVisit = [&](VertexId v) {
+        if (!isRoot[v]) {
+            pending.push_back(v);
+            return;
+        }
+        index--;
+        while (!pending.empty() && rindex[v] <= rindex[pending.back()]) {
+            rindex[pending.back()] = component;
+            pending.pop_back();
+            index--;
+        }
+        rindex[v] = component--;
+    };
 
-    // 3. Process vertices in order from stack to find SCCs
-    std::fill(visited.begin(), visited.end(), false);
-    std::vector<std::vector<int>> sccs;
+    for (VertexId s = 0; s < V; ++s) {
+        if (rindex[s] != 0) continue;
+        beginVisit(s);
+
+        while (!arena.frames.empty()) {
+            VertexId v = arena.frames.back().vertex;
+            int& e = arena.frames.back().edge;
+            if (e < static_cast<int>(adjList[v].size())) {
+                VertexId w = adjList[v][e++].first;
+                if (rindex[w] == 0) {
+                    beginVisit(w);
+                } else if (rindex[w] < rindex[v]) {
+                    rindex[v] = rindex[w];
+                    isRoot[v] = 0;
+                }
+                continue;
+            }
 
-    while (!Stack.empty()) {
-        int u = Stack.top(); Stack.pop();
-        if (!visited[u]) {
-            std::vector<int> component;
-            dfsCollect(u, visited, component, transposedGraph);
-            sccs.push_back(component);
+            arena.frames.pop_back();
+            finishVisit(v);
+            if (!arena.frames.empty()) {
+                VertexId parent = arena.frames.back().vertex;
+                if (rindex[v] < rindex[parent]) {
+                    rindex[parent] = rindex[v];
+                    isRoot[parent] = 0;
+                }
+            }
         }
     }
+
+    // Component numbers were handed out from V - 1 downwards; renumber from 0
+    // and group vertices with a counting sort.
+    BasicSCCResult<VertexId> result;
+    int count = static_cast<int>(V) - 1 - component;
+    result.componentOf.resize(V);
+    result.offsets.assign(count + 1, 0);
+    for (VertexId v = 0; v < V; ++v) {
+        result.componentOf[v] = static_cast<int>(V) - 1 - rindex[v];
+        result.offsets[result.componentOf[v] + 1]++;
+    }
+    for (int c = 0; c < count; ++c)
+        result.offsets[c + 1] += result.offsets[c];
+
+    result.vertices.resize(V);
+    vector<int>& cursor = arena.number; // rindex is no longer needed
+    cursor.assign(result.offsets.begin(), result.offsets.end() - 1);
+    for (VertexId v = 0; v < V; ++v)
+        result.vertices[cursor[result.componentOf[v]]++] = v;
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+std::vector<std::vector<VertexId>> BasicGraph<VertexId, Weight>::getSCCs() {
+    BasicSCCResult<VertexId> flat = getSCCsFlat();
+    std::vector<std::vector<VertexId>> sccs(flat.count());
+    for (int c = 0; c < flat.count(); ++c)
+        sccs[c].assign(flat.vertices.begin() + flat.offsets[c], flat.vertices.begin() + flat.offsets[c + 1]);
     return sccs;
 }
 
-std::vector<std::vector<int>> Graph::floydWarshall() {
-    std::vector<std::vector<int>> dist(V, std::vector<int>(V, INF));
+template <typename VertexId, typename Weight>
+std::vector<std::vector<typename BasicGraph<VertexId, Weight>::Distance>> BasicGraph<VertexId, Weight>::floydWarshall() {
+    const Distance INFINITE = infinity();
+    std::vector<std::vector<Distance>> dist(V, std::vector<Distance>(V, INFINITE));
 
-    for (int i = 0; i < V; ++i) {
+    for (VertexId i = 0; i < V; ++i) {
         dist[i][i] = 0;
     }
 
-    for (int u = 0; u < V; ++u) {
+    for (VertexId u = 0; u < V; ++u) {
         for (const auto& edge : adjList[u]) {
-            dist[u][edge.first] = edge.second;
+            dist[u][edge.first] = cost(edge.second);
         }
     }
 
-    for (int k = 0; k < V; ++k) {
-        for (int i = 0; i < V; ++i) {
-            for (int j = 0; j < V; ++j) {
-                if (dist[i][k] != INF && dist[k][j] != INF) {
+    for (VertexId k = 0; k < V; ++k) {
+        for (VertexId i = 0; i < V; ++i) {
+            for (VertexId j = 0; j < V; ++j) {
+                if (dist[i][k] != INFINITE && dist[k][j] != INFINITE) {
                     dist[i][j] = std::min(dist[i][j], dist[i][k] + dist[k][j]);
                 }
             }
@@ -572,50 +2061,126 @@ std::vector<std::vector<int>> Graph::floydWarshall() {
     return dist;
 }
 
-void Graph::removeEdge(int u, int v) {
+template <typename VertexId, typename Weight>
+std::vector<typename BasicGraph<VertexId, Weight>::Distance> BasicGraph<VertexId, Weight>::floydWarshallBlocked(ThreadPool& pool) {
+    const int BLOCK = 64;                             // 64 x 64 ints = 16 KB per tile
+    const Distance UNREACHABLE = infinity() / 2;      // Two of these added cannot overflow
+    const Distance THRESHOLD = infinity() / 4;
+    const size_t n = V;
+    const int size = static_cast<int>(V);
+
+    std::vector<Distance> dist(n * n, UNREACHABLE);
+    for (size_t i = 0; i < n; ++i)
+        dist[i * n + i] = 0;
+    for (size_t u = 0; u < n; ++u) {
+        for (const auto& edge : adjList[u])
+            dist[u * n + edge.first] = cost(edge.second);
+    }
+
+    Distance* d = dist.data();
+    // Relaxes tile (ib, jb) through the intermediate vertices of tile kb.
+    auto relaxTile = [d, n, size, BLOCK, THRESHOLD](int ib, int jb, int kb) {
+        int iEnd = std::min(size, (ib + 1) * BLOCK);
+        int jBegin = jb * BLOCK;
+        int jEnd = std::min(size, jBegin + BLOCK);
+        int kEnd = std::min(size, (kb + 1) * BLOCK);
+        for (int k = kb * BLOCK; k < kEnd; ++k) {
+            const Distance* rowK = d + k * n;
+            for (int i = ib * BLOCK; i < iEnd; ++i) {
+                Distance* rowI = d + i * n;
+                Distance dik = rowI[k];
+                if (dik >= THRESHOLD) continue;
+                for (int j = jBegin; j < jEnd; ++j)
+                    rowI[j] = std::min(rowI[j], dik + rowK[j]);
+            }
+        }
+    };
+
+    int blocks = (size + BLOCK - 1) / BLOCK;
+    for (int kb = 0; kb < blocks; ++kb) {
+        // Phase 1: the diagonal tile depends only on itself.
+        relaxTile(kb, kb, kb);
+
+        // Phase 2: tiles in row kb and column kb depend only on the diagonal tile.
+        pool.parallelFor(0, 2 * blocks, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t t = lo; t < hi; ++t) {
+                int other = static_cast<int>(t / 2);
+                if (other == kb) continue;
+                if (t % 2 == 0) relaxTile(kb, other, kb);
+                else relaxTile(other, kb, kb);
+            }
+        }, 1);
+
+        // Phase 3: every remaining tile depends only on its row and column tiles.
+        pool.parallelFor(0, static_cast<int64_t>(blocks) * blocks, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t t = lo; t < hi; ++t) {
+                int ib = static_cast<int>(t / blocks);
+                int jb = static_cast<int>(t % blocks);
+                if (ib != kb && jb != kb) relaxTile(ib, jb, kb);
+            }
+        }, 1);
+    }
+
+    for (Distance& value : dist) {
+        if (value >= THRESHOLD) value = infinity();
+    }
+    return dist;
+}
+
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::removeEdge(VertexId u, VertexId v) {
     if (u >= V || v >= V) return;
     adjList[u].erase(
-        remove_if(adjList[u].begin(), adjList[u].end(), 
-                  [v](const pair<int, int>& edge) { return edge.first == v; }),
+        remove_if(adjList[u].begin(), adjList[u].end(),
+                  [v](const Entry& edge) { return edge.first == v; }),
         adjList[u].end()
     );
-    adjMatrix[u][v] = 0;
+    edgeSet.erase(u, v);
+    if (!adjMatrix.empty()) adjMatrix[u][v] = 0;
 }
 
-void Graph::removeVertex(int v) {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::removeVertex(VertexId v) {
     if (v >= V) return;
     // Remove all outgoing edges from v
+    for (const auto& edge : adjList[v])
+        edgeSet.erase(v, edge.first);
     adjList[v].clear();
-    fill(adjMatrix[v].begin(), adjMatrix[v].end(), 0);
+    if (!adjMatrix.empty()) fill(adjMatrix[v].begin(), adjMatrix[v].end(), 0);
 
-    // Remove all incoming edges to v
-    for (int i = 0; i < V; ++i) {
-        removeEdge(i, v);
+    // Remove all incoming edges to v; the edge set skips lists without one
+    for (VertexId i = 0; i < V; ++i) {
+        if (edgeSet.contains(i, v)) removeEdge(i, v);
     }
 }
 
-bool Graph::edgeExists(int u, int v) {
+template <typename VertexId, typename Weight>
+bool BasicGraph<VertexId, Weight>::edgeExists(VertexId u, VertexId v) {
     if (u >= V || v >= V) return false;
-    return adjMatrix[u][v] != 0;
+    return edgeSet.contains(u, v);
 }
 
-std::vector<int> Graph::getNeighbors(int u) const {
+template <typename VertexId, typename Weight>
+std::vector<VertexId> BasicGraph<VertexId, Weight>::getNeighbors(VertexId u) const {
     if (u >= V) return {};
-    vector<int> neighbors;
+    vector<VertexId> neighbors;
     for (const auto& edge : adjList[u]) {
         neighbors.push_back(edge.first);
     }
     return neighbors;
 }
 
-int Graph::outDegree(int u) {
+template <typename VertexId, typename Weight>
+int BasicGraph<VertexId, Weight>::outDegree(VertexId u) {
     if (u >= V) return 0;
     return adjList[u].size();
 }
 
-Graph Graph::getTranspose() {
-    Graph transposed(V);
-    for (int u = 0; u < V; ++u) {
+template <typename VertexId, typename Weight>
+BasicGraph<VertexId, Weight> BasicGraph<VertexId, Weight>::getTranspose() {
+    BasicGraph transposed(V);
+    transposed.sortedNeighbors = sortedNeighbors; // Sources arrive in increasing order anyway
+    for (VertexId u = 0; u < V; ++u) {
         for (const auto& edge : adjList[u]) {
             transposed.addEdge(edge.first, u, edge.second);
         }
@@ -623,18 +2188,23 @@ Graph Graph::getTranspose() {
     return transposed;
 }
 
-void Graph::clear() {
-    for (int i = 0; i < V; ++i) {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::clear() {
+    for (VertexId i = 0; i < V; ++i) {
         adjList[i].clear();
-        fill(adjMatrix[i].begin(), adjMatrix[i].end(), 0);
+        if (!adjMatrix.empty()) fill(adjMatrix[i].begin(), adjMatrix[i].end(), 0);
     }
+    edgeSet.clear();
+    maxEdgeWeight = 0;
+    hasNegativeWeight = false;
 }
 
-void Graph::makeUndirected() {
-    for (int u = 0; u < V; ++u) {
+template <typename VertexId, typename Weight>
+void BasicGraph<VertexId, Weight>::makeUndirected() {
+    for (VertexId u = 0; u < V; ++u) {
         for (const auto& edge : adjList[u]) {
-            int v = edge.first;
-            int weight = edge.second;
+            VertexId v = edge.first;
+            Weight weight = edge.second;
             // Add reverse edge if it doesn't already exist
             if (!edgeExists(v, u)) {
                 addEdge(v, u, weight);
@@ -643,5 +2213,29 @@ void Graph::makeUndirected() {
     }
 }
 
+template <typename VertexId, typename Weight>
+VertexId BasicGraph<VertexId, Weight>::numVertices() const {
+    return V;
+}
+
+template <typename VertexId, typename Weight>
+vector<typename BasicGraph<VertexId, Weight>::EdgeType> BasicGraph<VertexId, Weight>::getEdgeList() const {
+    vector<EdgeType> edges;
+    size_t total = 0;
+    for (VertexId u = 0; u < V; ++u)
+        total += adjList[u].size();
+    edges.reserve(total);
+    for (VertexId u = 0; u < V; ++u) {
+        for (const auto& edge : adjList[u])
+            edges.push_back({u, edge.first, edge.second});
+    }
+    return edges;
+}
+
+template <typename VertexId, typename Weight>
+const vector<typename BasicGraph<VertexId, Weight>::Entry>& BasicGraph<VertexId, Weight>::adjacentEdges(VertexId u) const {
+    return adjList[u];
+}
+
 } // namespace data_structures
-#endif // GRAPH_HPP
\ No newline at end of file
+#endif // GRAPH_HPP
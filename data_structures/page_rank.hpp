@@ -0,0 +1,250 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef PAGE_RANK_HPP
+#define PAGE_RANK_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <cstdint>
+#include "graph.hpp"
+#include "csr_graph.hpp"
+#include "thread_pool.hpp"
+
+namespace data_structures {
+
+/**
+ * @brief Parameters of a PageRank run.
+ */
+struct PageRankOptions {
+    float damping = 0.85f;     ///< Probability of following an edge instead of teleporting
+    float tolerance = 1e-6f;   ///< Stop once the L1 change between iterations drops below this
+    int maxIterations = 100;   ///< Upper bound on power iterations
+};
+
+/**
+ * @brief Scores and convergence information of a PageRank run.
+ */
+struct PageRankResult {
+    std::vector<float> scores; ///< Score of each vertex; scores sum to 1
+    int iterations = 0;        ///< Power iterations performed
+    double residual = 0;       ///< L1 change of the last iteration
+    bool converged = false;    ///< True if residual fell below the tolerance
+};
+
+/**
+ * @brief Parallel PageRank and personalized PageRank by pull-based power iteration.
+ *
+ * The engine keeps the transposed CSR graph, so each vertex gathers
+ * rank / outDegree from its in-neighbors. Vertices are split into blocks holding
+ * roughly equal numbers of in-edges, and each block writes only its own scores
+ * and partial sums, so no atomics are needed. Scores and per-vertex contributions
+ * are contiguous float arrays reused across runs.
+ *
+ * Dangling vertices (no out-edges) hand their rank to the teleport distribution,
+ * which is uniform for compute() and given by the caller for personalized().
+ */
+class PageRank {
+private:
+    int V;                           ///< Number of vertices
+    CSRGraph incoming;               ///< In-edges of each vertex (transpose of the input)
+    std::vector<float> invOutDegree; ///< 1 / out-degree, 0 for dangling vertices
+    std::vector<int> blockStart;     ///< Size blocks + 1: vertex range of each block
+    ThreadPool& pool;                ///< Workers running the blocks
+    std::vector<float> contribution; ///< Rank divided by out-degree, per vertex
+    std::vector<float> next;         ///< Scores being computed by the current iteration
+    std::vector<double> blockSum;    ///< Per-block partial sums (dangling mass, residual)
+
+    /**
+     * @brief Splits vertices into blocks of roughly equal in-edge plus vertex count.
+     */
+    void partition();
+
+    /**
+     * @brief Runs the power iteration.
+     * @param teleport Teleport distribution summing to 1, or empty for uniform
+     */
+    PageRankResult iterate(const std::vector<float>& teleport, const PageRankOptions& options);
+
+public:
+    /**
+     * @brief Prepares PageRank for a CSR graph (builds its transpose).
+     * @param g Directed graph; the engine keeps its own copy of the structure
+     * @param workers Pool that runs the iterations
+     */
+    explicit PageRank(const CSRGraph& g, ThreadPool& workers = ThreadPool::defaultPool());
+
+    /**
+     * @brief Prepares PageRank for a Graph (converted to CSR once).
+     */
+    explicit PageRank(const Graph& g, ThreadPool& workers = ThreadPool::defaultPool());
+
+    /**
+     * @brief Global PageRank with uniform teleportation.
+     * @throws std::invalid_argument if the options are out of range
+     */
+    PageRankResult compute(const PageRankOptions& options = PageRankOptions());
+
+    /**
+     * @brief Personalized PageRank: teleports only to the seed vertices, uniformly.
+     * @param seeds Vertices to restart from (repeats add weight)
+     * @throws std::out_of_range if a seed is not a vertex
+     * @throws std::invalid_argument if seeds is empty or the options are out of range
+     */
+    PageRankResult personalized(const std::vector<int>& seeds, const PageRankOptions& options = PageRankOptions());
+
+    /**
+     * @brief Personalized PageRank with an arbitrary teleport preference per vertex.
+     * @param preference Non-negative weight per vertex (normalized internally)
+     * @throws std::invalid_argument if the size is wrong, a weight is negative or all are zero
+     */
+    PageRankResult personalized(const std::vector<float>& preference, const PageRankOptions& options = PageRankOptions());
+
+    /**
+     * @brief Returns the number of vertices.
+     */
+    int numVertices() const;
+};
+
+// --- Method Implementations ---
+
+PageRank::PageRank(const CSRGraph& g, ThreadPool& workers)
+    : V(g.numVertices()), incoming(g.getTranspose()), invOutDegree(V), pool(workers), contribution(V), next(V) {
+    for (int u = 0; u < V; ++u) {
+        int degree = g.outDegree(u);
+        invOutDegree[u] = degree > 0 ? 1.0f / degree : 0.0f;
+    }
+    partition();
+}
+
+PageRank::PageRank(const Graph& g, ThreadPool& workers) : PageRank(CSRGraph(g), workers) {}
+
+void PageRank::partition() {
+    // A few blocks per worker lets parallelFor balance uneven blocks dynamically.
+    int64_t work = static_cast<int64_t>(V) + incoming.numEdges();
+    int blocks = static_cast<int>(std::max<int64_t>(1, std::min<int64_t>(V, static_cast<int64_t>(pool.size()) * 4)));
+    blockStart.assign(1, 0);
+    int v = 0;
+    for (int b = 1; b < blocks; ++b) {
+        int64_t target = work * b / blocks;
+        while (v < V && static_cast<int64_t>(v) + incoming.edgeBegin(v) < target) ++v;
+        if (v > blockStart.back()) blockStart.push_back(v);
+    }
+    blockStart.push_back(V);
+    blockSum.assign(blockStart.size() - 1, 0.0);
+}
+
+PageRankResult PageRank::iterate(const std::vector<float>& teleport, const PageRankOptions& options) {
+    if (!(options.damping >= 0.0f && options.damping <= 1.0f))
+        throw std::invalid_argument("PageRank damping must be in [0, 1]");
+    if (!(options.tolerance >= 0.0f) || options.maxIterations < 0)
+        throw std::invalid_argument("PageRank tolerance and iteration limit must be non-negative");
+
+    PageRankResult result;
+    if (V == 0) {
+        result.converged = true;
+        return result;
+    }
+
+    const bool uniform = teleport.empty();
+    const float uniformShare = 1.0f / V;
+    const float d = options.damping;
+    const int64_t blocks = static_cast<int64_t>(blockSum.size());
+    std::vector<float>& rank = result.scores;
+    if (uniform) rank.assign(V, uniformShare);
+    else rank = teleport;
+
+    // Runs body(lo, hi) on every block and returns the sum of the values it returns.
+    auto forBlocks = [&](auto body) {
+        pool.parallelFor(0, blocks, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t b = lo; b < hi; ++b)
+                blockSum[b] = body(blockStart[b], blockStart[b + 1]);
+        }, 1);
+        double total = 0;
+        for (double s : blockSum) total += s; // Fixed order: results do not depend on scheduling
+        return total;
+    };
+
+    while (result.iterations < options.maxIterations) {
+        // Push side, made local: every vertex precomputes what it sends along each out-edge.
+        double danglingMass = forBlocks([&](int lo, int hi) {
+            double dangling = 0;
+            for (int u = lo; u < hi; ++u) {
+                contribution[u] = rank[u] * invOutDegree[u];
+                if (invOutDegree[u] == 0.0f) dangling += rank[u];
+            }
+            return dangling;
+        });
+
+        // Pull: gather contributions of in-neighbors; teleport and dangling mass follow `teleport`.
+        const float restart = static_cast<float>((1.0 - d) + d * danglingMass);
+        result.residual = forBlocks([&](int lo, int hi) {
+            double change = 0;
+            for (int v = lo; v < hi; ++v) {
+                float sum = 0.0f;
+                for (int e = incoming.edgeBegin(v); e < incoming.edgeEnd(v); ++e)
+                    sum += contribution[incoming.edgeTarget(e)];
+                float score = d * sum + restart * (uniform ? uniformShare : teleport[v]);
+                change += std::fabs(score - rank[v]);
+                next[v] = score;
+            }
+            return change;
+        });
+
+        rank.swap(next);
+        result.iterations++;
+        if (result.residual < options.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+PageRankResult PageRank::compute(const PageRankOptions& options) {
+    return iterate(std::vector<float>(), options);
+}
+
+PageRankResult PageRank::personalized(const std::vector<int>& seeds, const PageRankOptions& options) {
+    if (seeds.empty()) throw std::invalid_argument("Personalized PageRank needs at least one seed");
+    std::vector<float> teleport(V, 0.0f);
+    for (int s : seeds) {
+        if (s < 0 || s >= V) throw std::out_of_range("PageRank seed is not a vertex");
+        teleport[s] += 1.0f / seeds.size();
+    }
+    return iterate(teleport, options);
+}
+
+PageRankResult PageRank::personalized(const std::vector<float>& preference, const PageRankOptions& options) {
+    if (static_cast<int>(preference.size()) != V)
+        throw std::invalid_argument("Preference vector must have one weight per vertex");
+    double total = 0;
+    for (float p : preference) {
+        if (!(p >= 0.0f)) throw std::invalid_argument("Preference weights must be non-negative");
+        total += p;
+    }
+    if (total <= 0) throw std::invalid_argument("Preference weights must not all be zero");
+
+    std::vector<float> teleport(V);
+    for (int v = 0; v < V; ++v)
+        teleport[v] = static_cast<float>(preference[v] / total);
+    return iterate(teleport, options);
+}
+
+int PageRank::numVertices() const {
+    return V;
+}
+
+} // namespace data_structures
+
+#endif // PAGE_RANK_HPP
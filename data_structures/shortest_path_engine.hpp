@@ -0,0 +1,332 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef SHORTEST_PATH_ENGINE_HPP
+#define SHORTEST_PATH_ENGINE_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include "csr_graph.hpp"
+#include "thread_pool.hpp"
+
+namespace data_structures {
+
+/**
+ * @brief Result of a point-to-point shortest path query.
+ */
+struct PathResult {
+    int distance = INF;     ///< Length of the shortest path, INF if the target is unreachable
+    std::vector<int> path;  ///< Vertices from source to target, empty if unreachable
+    int settled = 0;        ///< Number of vertices the search settled (work measure)
+};
+
+/**
+ * @brief Runs many Dijkstra queries on one CSRGraph without per-query allocation.
+ *
+ * Each worker owns a workspace (distance array, binary heap, touched list) that is
+ * allocated once. A query records every vertex whose distance it sets, and the next
+ * query on that workspace resets only those entries, so a local search costs time
+ * proportional to the part of the graph it explores rather than O(V).
+ * Point-to-point queries (bidirectional Dijkstra and A*) stop as soon as the target
+ * is settled and reconstruct the path from parent pointers. Edge weights must be
+ * non-negative. The engine itself is not thread-safe; batches are parallelized internally.
+ */
+class ShortestPathEngine {
+public:
+    /**
+     * @brief Per-worker reusable buffers for one query at a time.
+     */
+    struct Workspace {
+        std::vector<int> dist;                  ///< Size V, INF except for touched vertices
+        std::vector<int> parent;                ///< Size V, predecessor on the search tree (valid where touched)
+        std::vector<int> touched;               ///< Vertices whose dist was set by the last query
+        std::vector<std::pair<int, int>> heap;  ///< Min-heap of {distance, vertex}
+    };
+
+private:
+    const CSRGraph& graph;             ///< Graph being queried (must outlive the engine)
+    ThreadPool& pool;                  ///< Workers used by batch queries
+    std::vector<Workspace> workspaces; ///< One per pool worker
+    std::unique_ptr<CSRGraph> reversed; ///< Transpose for backward searches, built on first use
+    Workspace backward;                 ///< Backward-search buffers for bidirectional queries
+
+    /**
+     * @brief Undoes the previous query on ws: resets touched distances and empties the heap.
+     */
+    static void reset(Workspace& ws);
+
+    /**
+     * @brief Marks v as reached from `from` at distance d and pushes it on the heap.
+     */
+    static void reach(Workspace& ws, int v, int d, int from, int key);
+
+    /**
+     * @brief Builds the source-to-target path by following forward then backward parents.
+     */
+    static std::vector<int> tracePath(const Workspace& forward, const Workspace* backwardWs, int meet);
+
+    /**
+     * @brief Runs Dijkstra from source in ws, first undoing the previous query.
+     * @param ws Workspace to use
+     * @param source Source vertex
+     * @param maxDistance Vertices farther than this are not settled or expanded
+     */
+    void run(Workspace& ws, int source, int maxDistance) const;
+
+public:
+    /**
+     * @brief Creates an engine bound to a graph and a thread pool.
+     * @param g Graph to query
+     * @param workers Pool that runs batch queries
+     */
+    explicit ShortestPathEngine(const CSRGraph& g, ThreadPool& workers = ThreadPool::defaultPool());
+
+    /**
+     * @brief Single-source query.
+     * @param source Source vertex
+     * @param maxDistance Optional search radius (default: unbounded)
+     * @return Distances (INF if unreachable or beyond the radius); valid until the next query
+     */
+    const std::vector<int>& query(int source, int maxDistance = INF);
+
+    /**
+     * @brief Vertices reached by the most recent query().
+     */
+    const std::vector<int>& lastTouched() const;
+
+    /**
+     * @brief Point-to-point shortest path with bidirectional Dijkstra.
+     *
+     * Searches forward from source and backward from target (on the transposed graph),
+     * always expanding the side with the smaller tentative distance, and stops once the
+     * two frontiers' minimum keys add up to the best meeting distance found.
+     * @param source Source vertex
+     * @param target Target vertex
+     * @return Distance, vertex path and settled-vertex count
+     */
+    PathResult shortestPath(int source, int target);
+
+    /**
+     * @brief Point-to-point shortest path with A* search.
+     * @param source Source vertex
+     * @param target Target vertex
+     * @param heuristic Callable heuristic(v) returning a lower bound on the distance
+     *        from v to target (admissible; never overestimates). Passed as a template
+     *        parameter so it is inlined into the search loop.
+     * @return Distance, vertex path and settled-vertex count
+     */
+    template <typename Heuristic>
+    PathResult aStar(int source, int target, Heuristic heuristic);
+
+    /**
+     * @brief Runs one query per source across the pool and hands each result to a callback.
+     *
+     * visit(sourceIndex, ws, workerId) is called on the worker that ran the query,
+     * before its workspace is reused; read ws.dist at the vertices in ws.touched.
+     * @param sources Source vertices
+     * @param visit Callback consuming each result
+     * @param maxDistance Optional search radius applied to every query
+     */
+    template <typename Visitor>
+    void batch(const std::vector<int>& sources, Visitor visit, int maxDistance = INF);
+
+    /**
+     * @brief Runs one query per source across the pool and returns dense distance arrays.
+     * @param sources Source vertices
+     * @return result[i] holds the distances from sources[i]
+     */
+    std::vector<std::vector<int>> batchDistances(const std::vector<int>& sources);
+};
+
+// --- Method Implementations ---
+
+ShortestPathEngine::ShortestPathEngine(const CSRGraph& g, ThreadPool& workers)
+    : graph(g), pool(workers), workspaces(workers.size()) {
+    for (Workspace& ws : workspaces) {
+        ws.dist.assign(graph.numVertices(), INF);
+        ws.parent.assign(graph.numVertices(), -1);
+    }
+}
+
+void ShortestPathEngine::reset(Workspace& ws) {
+    for (int v : ws.touched)
+        ws.dist[v] = INF;
+    ws.touched.clear();
+    ws.heap.clear();
+}
+
+void ShortestPathEngine::reach(Workspace& ws, int v, int d, int from, int key) {
+    if (ws.dist[v] == INF) ws.touched.push_back(v);
+    ws.dist[v] = d;
+    ws.parent[v] = from;
+    ws.heap.push_back({key, v});
+    std::push_heap(ws.heap.begin(), ws.heap.end(), std::greater<std::pair<int, int>>());
+}
+
+std::vector<int> ShortestPathEngine::tracePath(const Workspace& forward, const Workspace* backwardWs, int meet) {
+    std::vector<int> path;
+    for (int v = meet; v != -1; v = forward.parent[v])
+        path.push_back(v);
+    std::reverse(path.begin(), path.end());
+    if (backwardWs != nullptr) {
+        for (int v = backwardWs->parent[meet]; v != -1; v = backwardWs->parent[v])
+            path.push_back(v);
+    }
+    return path;
+}
+
+void ShortestPathEngine::run(Workspace& ws, int source, int maxDistance) const {
+    reset(ws);
+    if (source < 0 || source >= graph.numVertices()) return;
+
+    auto cmp = std::greater<std::pair<int, int>>();
+    ws.dist[source] = 0;
+    ws.parent[source] = -1;
+    ws.touched.push_back(source);
+    ws.heap.push_back({0, source});
+
+    while (!ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), cmp);
+        int d = ws.heap.back().first;
+        int u = ws.heap.back().second;
+        ws.heap.pop_back();
+        if (d > ws.dist[u]) continue;
+
+        for (int e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e) {
+            int v = graph.edgeTarget(e);
+            int nd = d + graph.edgeWeight(e);
+            if (nd < ws.dist[v] && nd <= maxDistance)
+                reach(ws, v, nd, u, nd);
+        }
+    }
+}
+
+const std::vector<int>& ShortestPathEngine::query(int source, int maxDistance) {
+    run(workspaces[0], source, maxDistance);
+    return workspaces[0].dist;
+}
+
+const std::vector<int>& ShortestPathEngine::lastTouched() const {
+    return workspaces[0].touched;
+}
+
+PathResult ShortestPathEngine::shortestPath(int source, int target) {
+    PathResult result;
+    int n = graph.numVertices();
+    if (source < 0 || source >= n || target < 0 || target >= n) return result;
+    if (!reversed) {
+        reversed.reset(new CSRGraph(graph.getTranspose()));
+        backward.dist.assign(n, INF);
+        backward.parent.assign(n, -1);
+    }
+
+    Workspace& fwd = workspaces[0];
+    reset(fwd);
+    reset(backward);
+    reach(fwd, source, 0, -1, 0);
+    reach(backward, target, 0, -1, 0);
+
+    auto cmp = std::greater<std::pair<int, int>>();
+    int best = (source == target) ? 0 : INF;
+    int meet = (source == target) ? source : -1;
+
+    while (!fwd.heap.empty() && !backward.heap.empty()) {
+        // Neither side can improve on best once their smallest keys sum past it.
+        if (static_cast<long long>(fwd.heap.front().first) + backward.heap.front().first >= best) break;
+
+        bool forwardSide = fwd.heap.front().first <= backward.heap.front().first;
+        Workspace& ws = forwardSide ? fwd : backward;
+        const Workspace& other = forwardSide ? backward : fwd;
+        const CSRGraph& g = forwardSide ? graph : *reversed;
+
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), cmp);
+        int d = ws.heap.back().first;
+        int u = ws.heap.back().second;
+        ws.heap.pop_back();
+        if (d > ws.dist[u]) continue;
+        result.settled++;
+
+        for (int e = g.edgeBegin(u); e < g.edgeEnd(u); ++e) {
+            int v = g.edgeTarget(e);
+            int nd = d + g.edgeWeight(e);
+            if (nd < ws.dist[v]) reach(ws, v, nd, u, nd);
+            if (other.dist[v] != INF && ws.dist[v] + other.dist[v] < best) {
+                best = ws.dist[v] + other.dist[v];
+                meet = v;
+            }
+        }
+    }
+
+    if (meet == -1) return result;
+    result.distance = best;
+    result.path = tracePath(fwd, &backward, meet);
+    return result;
+}
+
+template <typename Heuristic>
+PathResult ShortestPathEngine::aStar(int source, int target, Heuristic heuristic) {
+    PathResult result;
+    int n = graph.numVertices();
+    if (source < 0 || source >= n || target < 0 || target >= n) return result;
+
+    Workspace& ws = workspaces[0];
+    reset(ws);
+    reach(ws, source, 0, -1, heuristic(source));
+
+    auto cmp = std::greater<std::pair<int, int>>();
+    while (!ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), cmp);
+        int key = ws.heap.back().first;
+        int u = ws.heap.back().second;
+        ws.heap.pop_back();
+        if (key - heuristic(u) > ws.dist[u]) continue; // Stale entry
+        result.settled++;
+
+        if (u == target) {
+            result.distance = ws.dist[u];
+            result.path = tracePath(ws, nullptr, u);
+            return result;
+        }
+
+        for (int e = graph.edgeBegin(u); e < graph.edgeEnd(u); ++e) {
+            int v = graph.edgeTarget(e);
+            int nd = ws.dist[u] + graph.edgeWeight(e);
+            if (nd < ws.dist[v]) reach(ws, v, nd, u, nd + heuristic(v));
+        }
+    }
+    return result;
+}
+
+template <typename Visitor>
+void ShortestPathEngine::batch(const std::vector<int>& sources, Visitor visit, int maxDistance) {
+    pool.parallelFor(0, static_cast<int64_t>(sources.size()), [&](int64_t lo, int64_t hi, int worker) {
+        Workspace& ws = workspaces[worker];
+        for (int64_t i = lo; i < hi; ++i) {
+            run(ws, sources[i], maxDistance);
+            visit(static_cast<int>(i), static_cast<const Workspace&>(ws), worker);
+        }
+    }, 1);
+}
+
+std::vector<std::vector<int>> ShortestPathEngine::batchDistances(const std::vector<int>& sources) {
+    std::vector<std::vector<int>> result(sources.size());
+    batch(sources, [&](int i, const Workspace& ws, int) {
+        result[i] = ws.dist;
+    });
+    return result;
+}
+
+} // namespace data_structures
+
+#endif // SHORTEST_PATH_ENGINE_HPP
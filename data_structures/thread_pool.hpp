@@ -0,0 +1,221 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+namespace data_structures {
+
+/**
+ * @brief Fixed-size pool of worker threads for fork-join parallel loops.
+ *
+ * The calling thread participates as worker 0, so a pool of size 1 runs
+ * everything inline and spawns no threads. Workers sleep between jobs and
+ * are reused across calls, so parallel algorithms pay no thread start-up cost.
+ * A pool runs one job at a time: do not call run() from inside a task or from
+ * two threads at once.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;       ///< Helper threads (ids 1 .. size-1)
+    std::mutex mtx;                         ///< Guards the fields below
+    std::condition_variable wakeUp;         ///< Signals a new job or shutdown
+    std::condition_variable jobDone;        ///< Signals that helpers finished the job
+    const std::function<void(int)>* job;    ///< Current job, called with the worker id
+    uint64_t generation;                    ///< Incremented per job so helpers run it once
+    int running;                            ///< Helpers still executing the current job
+    bool stopping;                          ///< Set by the destructor
+
+    /**
+     * @brief Main loop of helper thread `id`.
+     */
+    void workerLoop(int id);
+
+public:
+    /**
+     * @brief Creates a pool with the given number of workers.
+     * @param threads Worker count including the caller; 0 uses hardware_concurrency()
+     */
+    explicit ThreadPool(int threads = 0);
+
+    /**
+     * @brief Stops and joins all helper threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns the number of workers, including the calling thread.
+     */
+    int size() const;
+
+    /**
+     * @brief Runs task(workerId) once on every worker and waits for all of them.
+     * @param task Callable taking the worker id in [0, size())
+     */
+    void run(const std::function<void(int)>& task);
+
+    /**
+     * @brief Splits [begin, end) into chunks of `grain` indices claimed dynamically by workers.
+     * @param begin First index
+     * @param end One past the last index
+     * @param body Callable body(lo, hi, workerId) processing [lo, hi)
+     * @param grain Chunk size
+     */
+    template <typename Func>
+    void parallelFor(int64_t begin, int64_t end, Func body, int64_t grain = 1024);
+
+    /**
+     * @brief Returns a process-wide pool sized to the hardware, created on first use.
+     */
+    static ThreadPool& defaultPool();
+};
+
+/**
+ * @brief Sorts [first, last) by sorting one block per worker, then merging blocks pairwise in parallel rounds.
+ * @param pool Worker threads
+ * @param first Begin of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering
+ */
+template <typename RandomIt, typename Compare>
+void parallelSort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp);
+
+// --- Method Implementations ---
+
+ThreadPool::ThreadPool(int threads) : job(nullptr), generation(0), running(0), stopping(false) {
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int id = 1; id < threads; ++id)
+        workers.emplace_back(&ThreadPool::workerLoop, this, id);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& t : workers)
+        t.join();
+}
+
+void ThreadPool::workerLoop(int id) {
+    uint64_t seen = 0;
+    while (true) {
+        const std::function<void(int)>* task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            wakeUp.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            task = job;
+        }
+        (*task)(id);
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--running == 0) jobDone.notify_one();
+        }
+    }
+}
+
+int ThreadPool::size() const {
+    return static_cast<int>(workers.size()) + 1;
+}
+
+void ThreadPool::run(const std::function<void(int)>& task) {
+    if (workers.empty()) {
+        task(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        job = &task;
+        running = static_cast<int>(workers.size());
+        generation++;
+    }
+    wakeUp.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> lock(mtx);
+    jobDone.wait(lock, [&] { return running == 0; });
+    job = nullptr;
+}
+
+template <typename Func>
+void ThreadPool::parallelFor(int64_t begin, int64_t end, Func body, int64_t grain) {
+    if (begin >= end) return;
+    if (grain < 1) grain = 1;
+    if (workers.empty() || end - begin <= grain) {
+        body(begin, end, 0);
+        return;
+    }
+    std::atomic<int64_t> next(begin);
+    run([&](int worker) {
+        while (true) {
+            int64_t lo = next.fetch_add(grain);
+            if (lo >= end) break;
+            body(lo, std::min(end, lo + grain), worker);
+        }
+    });
+}
+
+ThreadPool& ThreadPool::defaultPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+template <typename RandomIt, typename Compare>
+void parallelSort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp) {
+    int64_t n = last - first;
+    int64_t blocks = std::min<int64_t>(pool.size(), n / 4096);
+    if (blocks <= 1) {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    std::vector<int64_t> bounds(blocks + 1);
+    for (int64_t b = 0; b <= blocks; ++b)
+        bounds[b] = n * b / blocks;
+    pool.parallelFor(0, blocks, [&](int64_t lo, int64_t hi, int) {
+        for (int64_t b = lo; b < hi; ++b)
+            std::sort(first + bounds[b], first + bounds[b + 1], comp);
+    }, 1);
+
+    // Merge neighbouring runs: width 1, 2, 4, ... blocks per run.
+    for (int64_t width = 1; width < blocks; width *= 2) {
+        int64_t pairs = (blocks + 2 * width - 1) / (2 * width);
+        pool.parallelFor(0, pairs, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t p = lo; p < hi; ++p) {
+                int64_t left = 2 * width * p;
+                int64_t mid = std::min(blocks, left + width);
+                int64_t right = std::min(blocks, left + 2 * width);
+                if (mid < right)
+                    std::inplace_merge(first + bounds[left], first + bounds[mid], first + bounds[right], comp);
+            }
+        }, 1);
+    }
+}
+
+} // namespace data_structures
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,363 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef VERTEX_ORDERING_HPP
+#define VERTEX_ORDERING_HPP
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include "graph.hpp"
+
+namespace data_structures {
+
+/**
+ * @brief A relabeling of graph vertices, kept in both directions.
+ *
+ * Graphs with arbitrary vertex ids make traversals jump around their per-vertex
+ * arrays (dist, visited, ...). Renumbering vertices so that neighbors get nearby
+ * ids turns those jumps into mostly sequential accesses. The factories compute
+ * such an order; apply() builds the relabeled graph, and toOriginal() /
+ * verticesToOriginal() translate results computed on it back to the old ids.
+ *
+ * Orderings treat edges as undirected, so directed graphs are ordered by their
+ * underlying undirected structure.
+ */
+template <typename VertexId = int>
+class VertexPermutation {
+private:
+    vector<VertexId> newIdOf; ///< Old id -> new id
+    vector<VertexId> oldIdOf; ///< New id -> old id
+
+    /**
+     * @brief Undirected neighbors (out- plus in-edges) of every vertex, as CSR arrays.
+     */
+    template <typename Weight>
+    static void undirectedAdjacency(const BasicGraph<VertexId, Weight>& g, vector<int64_t>& offsets, vector<VertexId>& targets);
+
+    /**
+     * @brief BFS from start over the undirected adjacency, appending visited vertices to order.
+     *
+     * Neighbors are enqueued in increasing degree (ties by id) when byDegree is set,
+     * otherwise in adjacency order. mark[v] == stamp means v is already visited.
+     * @param lastLevel Set to the index in order where the deepest BFS level begins
+     * @return Number of BFS levels
+     */
+    static size_t levelSearch(VertexId start, const vector<int64_t>& offsets, const vector<VertexId>& targets,
+                              vector<int>& mark, int stamp, bool byDegree, vector<VertexId>& order, size_t& lastLevel);
+
+public:
+    /**
+     * @brief Builds a permutation from a vertex order.
+     * @param order order[i] is the old id of the vertex that gets new id i
+     * @throws std::invalid_argument if order is not a permutation of 0 .. size - 1
+     */
+    explicit VertexPermutation(const vector<VertexId>& order);
+
+    /**
+     * @brief Reverse Cuthill-McKee order: bandwidth-reducing BFS from a pseudo-peripheral vertex.
+     *
+     * Each component starts at a low-degree vertex on the far side of the component
+     * (repeated BFS until the depth stops growing), visits neighbors in increasing
+     * degree, and the whole order is reversed at the end.
+     */
+    template <typename Weight>
+    static VertexPermutation reverseCuthillMcKee(const BasicGraph<VertexId, Weight>& g);
+
+    /**
+     * @brief Orders vertices by decreasing degree (ties by id), clustering hubs at the front.
+     */
+    template <typename Weight>
+    static VertexPermutation degreeDescending(const BasicGraph<VertexId, Weight>& g);
+
+    /**
+     * @brief Orders vertices as a BFS visits them.
+     * @param start First BFS root; unreached vertices start new searches in id order
+     */
+    template <typename Weight>
+    static VertexPermutation breadthFirst(const BasicGraph<VertexId, Weight>& g, VertexId start = 0);
+
+    /**
+     * @brief Returns g with every vertex v renamed to toNew(v).
+     *
+     * Each adjacency list is sorted by new neighbor id, so scans also touch
+     * neighbor data in increasing address order.
+     * @throws std::invalid_argument if g has a different number of vertices
+     */
+    template <typename Weight>
+    BasicGraph<VertexId, Weight> apply(const BasicGraph<VertexId, Weight>& g) const;
+
+    /**
+     * @brief Translates per-vertex values of the relabeled graph (e.g. distances) to old ids.
+     * @param values values[newId]
+     * @return result[oldId]
+     */
+    template <typename T>
+    vector<T> toOriginal(const vector<T>& values) const;
+
+    /**
+     * @brief Translates a list of relabeled vertices (e.g. a topological order) to old ids.
+     */
+    vector<VertexId> verticesToOriginal(const vector<VertexId>& vertices) const;
+
+    /**
+     * @brief Returns the new id of an old vertex.
+     */
+    VertexId toNew(VertexId oldId) const;
+
+    /**
+     * @brief Returns the old id of a new vertex.
+     */
+    VertexId toOld(VertexId newId) const;
+
+    /**
+     * @brief Returns the number of vertices.
+     */
+    VertexId size() const;
+
+    /**
+     * @brief Returns the permutation with old and new ids swapped.
+     */
+    VertexPermutation inverse() const;
+};
+
+/**
+ * @brief Permutation for the default int-based Graph.
+ */
+using VertexOrdering = VertexPermutation<int>;
+
+// --- Method Implementations ---
+
+template <typename VertexId>
+VertexPermutation<VertexId>::VertexPermutation(const vector<VertexId>& order) : newIdOf(order.size()), oldIdOf(order) {
+    vector<char> seen(order.size(), 0);
+    for (size_t i = 0; i < order.size(); ++i) {
+        VertexId v = order[i];
+        if (v < 0 || static_cast<size_t>(v) >= order.size() || seen[v])
+            throw std::invalid_argument("Vertex order is not a permutation");
+        seen[v] = 1;
+        newIdOf[v] = static_cast<VertexId>(i);
+    }
+}
+
+template <typename VertexId>
+template <typename Weight>
+void VertexPermutation<VertexId>::undirectedAdjacency(const BasicGraph<VertexId, Weight>& g, vector<int64_t>& offsets, vector<VertexId>& targets) {
+    const size_t n = g.numVertices();
+    offsets.assign(n + 1, 0);
+    for (size_t u = 0; u < n; ++u) {
+        for (const auto& edge : g.adjacentEdges(u)) {
+            offsets[u + 1]++;
+            offsets[edge.first + 1]++;
+        }
+    }
+    for (size_t u = 0; u < n; ++u)
+        offsets[u + 1] += offsets[u];
+
+    targets.resize(offsets[n]);
+    vector<int64_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t u = 0; u < n; ++u) {
+        for (const auto& edge : g.adjacentEdges(u)) {
+            targets[cursor[u]++] = edge.first;
+            targets[cursor[edge.first]++] = static_cast<VertexId>(u);
+        }
+    }
+}
+
+template <typename VertexId>
+size_t VertexPermutation<VertexId>::levelSearch(VertexId start, const vector<int64_t>& offsets, const vector<VertexId>& targets,
+                                                vector<int>& mark, int stamp, bool byDegree, vector<VertexId>& order, size_t& lastLevel) {
+    auto degree = [&](VertexId v) { return offsets[v + 1] - offsets[v]; };
+    size_t head = order.size();
+    size_t levelEnd = head + 1; // One past the last vertex of the level being scanned
+    size_t levels = 1;
+    lastLevel = head;
+    mark[start] = stamp;
+    order.push_back(start);
+
+    while (head < order.size()) {
+        if (head == levelEnd) {
+            lastLevel = levelEnd;
+            levelEnd = order.size();
+            levels++;
+        }
+        VertexId u = order[head++];
+        size_t firstChild = order.size();
+        for (int64_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+            VertexId v = targets[e];
+            if (mark[v] == stamp) continue;
+            mark[v] = stamp;
+            order.push_back(v);
+        }
+        if (byDegree) {
+            std::sort(order.begin() + firstChild, order.end(), [&](VertexId a, VertexId b) {
+                return degree(a) != degree(b) ? degree(a) < degree(b) : a < b;
+            });
+        }
+    }
+    return levels;
+}
+
+template <typename VertexId>
+template <typename Weight>
+VertexPermutation<VertexId> VertexPermutation<VertexId>::reverseCuthillMcKee(const BasicGraph<VertexId, Weight>& g) {
+    const size_t n = g.numVertices();
+    vector<int64_t> offsets;
+    vector<VertexId> targets;
+    undirectedAdjacency(g, offsets, targets);
+    auto degree = [&](VertexId v) { return offsets[v + 1] - offsets[v]; };
+
+    // Scanning vertices by increasing degree, the first unvisited one is the
+    // lowest-degree vertex of a new component.
+    vector<VertexId> byDegree(n);
+    for (size_t v = 0; v < n; ++v) byDegree[v] = static_cast<VertexId>(v);
+    std::stable_sort(byDegree.begin(), byDegree.end(), [&](VertexId a, VertexId b) { return degree(a) < degree(b); });
+
+    vector<int> visited(n, 0); // 1 once placed in the final order
+    vector<int> probe(n, 0);   // Stamps of the pseudo-peripheral searches
+    int stamp = 0;
+    vector<VertexId> order;
+    order.reserve(n);
+    vector<VertexId> levels;
+    size_t lastLevel;
+
+    for (VertexId s : byDegree) {
+        if (visited[s]) continue;
+
+        // Pseudo-peripheral start: hop to the lowest-degree vertex of the deepest
+        // BFS level for as long as that makes the level structure deeper.
+        VertexId root = s;
+        levels.clear();
+        size_t depth = levelSearch(root, offsets, targets, probe, ++stamp, false, levels, lastLevel);
+        while (true) {
+            VertexId candidate = levels[lastLevel];
+            for (size_t i = lastLevel; i < levels.size(); ++i) {
+                if (degree(levels[i]) < degree(candidate)) candidate = levels[i];
+            }
+            levels.clear();
+            size_t candidateDepth = levelSearch(candidate, offsets, targets, probe, ++stamp, false, levels, lastLevel);
+            if (candidateDepth <= depth) break;
+            root = candidate;
+            depth = candidateDepth;
+        }
+
+        levelSearch(root, offsets, targets, visited, 1, true, order, lastLevel);
+    }
+
+    std::reverse(order.begin(), order.end());
+    return VertexPermutation(order);
+}
+
+template <typename VertexId>
+template <typename Weight>
+VertexPermutation<VertexId> VertexPermutation<VertexId>::degreeDescending(const BasicGraph<VertexId, Weight>& g) {
+    const size_t n = g.numVertices();
+    vector<int64_t> degree(n, 0);
+    for (size_t u = 0; u < n; ++u) {
+        for (const auto& edge : g.adjacentEdges(u)) {
+            degree[u]++;
+            degree[edge.first]++;
+        }
+    }
+    vector<VertexId> order(n);
+    for (size_t v = 0; v < n; ++v) order[v] = static_cast<VertexId>(v);
+    std::stable_sort(order.begin(), order.end(), [&](VertexId a, VertexId b) { return degree[a] > degree[b]; });
+    return VertexPermutation(order);
+}
+
+template <typename VertexId>
+template <typename Weight>
+VertexPermutation<VertexId> VertexPermutation<VertexId>::breadthFirst(const BasicGraph<VertexId, Weight>& g, VertexId start) {
+    const size_t n = g.numVertices();
+    vector<int64_t> offsets;
+    vector<VertexId> targets;
+    undirectedAdjacency(g, offsets, targets);
+
+    vector<int> visited(n, 0);
+    vector<VertexId> order;
+    order.reserve(n);
+    size_t lastLevel;
+    if (n > 0 && start >= 0 && static_cast<size_t>(start) < n)
+        levelSearch(start, offsets, targets, visited, 1, false, order, lastLevel);
+    for (size_t v = 0; v < n; ++v) {
+        if (!visited[v]) levelSearch(static_cast<VertexId>(v), offsets, targets, visited, 1, false, order, lastLevel);
+    }
+    return VertexPermutation(order);
+}
+
+template <typename VertexId>
+template <typename Weight>
+BasicGraph<VertexId, Weight> VertexPermutation<VertexId>::apply(const BasicGraph<VertexId, Weight>& g) const {
+    const size_t n = oldIdOf.size();
+    if (static_cast<size_t>(g.numVertices()) != n)
+        throw std::invalid_argument("Permutation size does not match the graph");
+
+    // Sources are emitted in new-id order, so only each list needs sorting.
+    vector<BasicEdge<VertexId, Weight>> edges;
+    for (size_t u = 0; u < n; ++u) {
+        size_t first = edges.size();
+        for (const auto& edge : g.adjacentEdges(oldIdOf[u]))
+            edges.push_back({static_cast<VertexId>(u), newIdOf[edge.first], edge.second});
+        std::stable_sort(edges.begin() + first, edges.end(),
+                         [](const BasicEdge<VertexId, Weight>& a, const BasicEdge<VertexId, Weight>& b) { return a.v < b.v; });
+    }
+
+    BasicGraph<VertexId, Weight> relabeled(g.numVertices());
+    relabeled.addEdges(edges);
+    return relabeled;
+}
+
+template <typename VertexId>
+template <typename T>
+vector<T> VertexPermutation<VertexId>::toOriginal(const vector<T>& values) const {
+    vector<T> result;
+    result.reserve(values.size());
+    for (size_t v = 0; v < values.size(); ++v)
+        result.push_back(values[newIdOf[v]]);
+    return result;
+}
+
+template <typename VertexId>
+vector<VertexId> VertexPermutation<VertexId>::verticesToOriginal(const vector<VertexId>& vertices) const {
+    vector<VertexId> result(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+        result[i] = oldIdOf[vertices[i]];
+    return result;
+}
+
+template <typename VertexId>
+VertexId VertexPermutation<VertexId>::toNew(VertexId oldId) const {
+    if (oldId < 0 || static_cast<size_t>(oldId) >= newIdOf.size())
+        throw std::out_of_range("Vertex id out of range");
+    return newIdOf[oldId];
+}
+
+template <typename VertexId>
+VertexId VertexPermutation<VertexId>::toOld(VertexId newId) const {
+    if (newId < 0 || static_cast<size_t>(newId) >= oldIdOf.size())
+        throw std::out_of_range("Vertex id out of range");
+    return oldIdOf[newId];
+}
+
+template <typename VertexId>
+VertexId VertexPermutation<VertexId>::size() const {
+    return static_cast<VertexId>(oldIdOf.size());
+}
+
+template <typename VertexId>
+VertexPermutation<VertexId> VertexPermutation<VertexId>::inverse() const {
+    return VertexPermutation(newIdOf);
+}
+
+} // namespace data_structures
+
+#endif // VERTEX_ORDERING_HPP
@@ -0,0 +1,69 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#ifndef VISITOR_HPP
+#define VISITOR_HPP
+
+#include <type_traits>
+#include <utility>
+
+namespace data_structures {
+
+/**
+ * @brief What a traversal does after a visitor callback returns.
+ */
+enum class VisitAction {
+    Continue, ///< Carry on normally
+    Skip,     ///< Do not expand this vertex / follow this edge / descend below this node
+    Stop      ///< End the whole traversal now
+};
+
+/**
+ * @brief Calls a visitor callback and reports what the traversal should do next.
+ *
+ * Callbacks may return VisitAction or nothing at all; a void callback always
+ * continues. The choice is made at compile time, so a callback that returns
+ * void costs nothing beyond its own body.
+ * @param callback Callable taking no arguments
+ * @return The action returned by callback, or VisitAction::Continue
+ */
+template <typename Callback>
+inline VisitAction visitStep(Callback&& callback) {
+    if constexpr (std::is_void<decltype(std::forward<Callback>(callback)())>::value) {
+        std::forward<Callback>(callback)();
+        return VisitAction::Continue;
+    } else {
+        return std::forward<Callback>(callback)();
+    }
+}
+
+/**
+ * @brief Graph visitor whose callbacks all do nothing.
+ *
+ * Derive from it and hide only the callbacks you need; the traversal is a
+ * template over the visitor type, so calls are resolved and inlined at
+ * compile time (no virtual functions). Each callback may return void or a
+ * VisitAction.
+ *
+ * - discoverVertex(v): v is reached for the first time. Skip leaves v unexpanded.
+ * - examineEdge(u, v, weight): edge u -> v is looked at. Skip ignores the edge.
+ * - finishVertex(v): all edges of v have been examined.
+ */
+template <typename VertexId, typename Weight>
+struct GraphVisitor {
+    void discoverVertex(VertexId) {}
+    void examineEdge(VertexId, VertexId, const Weight&) {}
+    void finishVertex(VertexId) {}
+};
+
+} // namespace data_structures
+
+#endif // VISITOR_HPP
@@ -147,6 +147,43 @@ void testTreeDiameterAndPathSum() {
     cout << "Max Path Sum: " << t.maxPathSum() << endl;
 }
 
+// Test visitor-based traversals
+void testVisitors() {
+    Tree t;
+    for (int val : { 50, 30, 70, 20, 40, 60, 80 })
+        t.insertBST(val);
+
+    printSection("Sum via Inorder Visitor");
+    int sum = 0;
+    t.inorderVisit([&](int val) { sum += val; });
+    cout << "Sum: " << sum << endl;
+
+    printSection("First Value Above 45 (Early Stop)");
+    int found = -1;
+    bool finished = t.inorderVisit([&](int val) {
+        if (val <= 45) return VisitAction::Continue;
+        found = val;
+        return VisitAction::Stop;
+    });
+    cout << "Found: " << found << ", traversal finished: " << (finished ? "Yes" : "No") << endl;
+
+    printSection("Preorder Skipping Subtree of 30");
+    t.preorderVisit([](int val) {
+        cout << val << " ";
+        return val == 30 ? VisitAction::Skip : VisitAction::Continue;
+    });
+    cout << endl;
+
+    printSection("Postorder and Level Order into Vectors");
+    vector<int> post, level;
+    t.postorderVisit([&](int val) { post.push_back(val); });
+    t.levelOrderVisit([&](int val) { level.push_back(val); });
+    for (int val : post) cout << val << " ";
+    cout << endl;
+    for (int val : level) cout << val << " ";
+    cout << endl;
+}
+
 int main() {
     testInsertionAndTraversals();
     testSearchAndDelete();
@@ -154,6 +191,7 @@ int main() {
     testAdvancedOperations();
     testVisualAndPaths();
     testTreeDiameterAndPathSum();
+    testVisitors();
     cout<<"ALL tests completed.";
     return 0;
 }
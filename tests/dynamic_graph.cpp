@@ -0,0 +1,60 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#include "../data_structures/dynamic_graph.hpp"
+using namespace data_structures;
+
+void printComponents(const DynamicGraph& g) {
+    std::cout << "Components: " << g.countConnectedComponents() << " | ids: ";
+    for (int v = 0; v < g.numVertices(); ++v)
+        std::cout << g.componentOf(v) << " ";
+    std::cout << "\n";
+}
+
+int main() {
+    std::cout << "========== DYNAMIC GRAPH TESTING ==========\n";
+
+    DynamicGraph g(6);
+    printComponents(g);
+
+    std::cout << "\n-- Batched Inserts --\n";
+    g.applyBatch({{0, 1, 4, true}, {1, 2, 5, true}, {2, 0, 1, true}, {3, 4, 2, true}, {4, 5, 7, true}});
+    std::cout << "Edges: " << g.numEdges() << "\n";
+    printComponents(g);
+    std::cout << "0 and 2 connected? " << (g.isConnected(0, 2) ? "Yes" : "No") << "\n";
+    std::cout << "0 and 5 connected? " << (g.isConnected(0, 5) ? "Yes" : "No") << "\n";
+
+    std::cout << "\n-- Mixed Batch (join, then cut) --\n";
+    g.applyBatch({{2, 3, 3, true}, {4, 5, 0, false}, {0, 1, 9, true}});
+    std::cout << "Edges: " << g.numEdges() << ", weight of 0 -> 1: " << g.adjacentEdges(0)[0].second << "\n";
+    printComponents(g);
+
+    std::cout << "\n-- Deleting a Cycle Edge Keeps the Component --\n";
+    g.removeEdge(1, 2);
+    std::cout << "Edge 1 -> 2 exists? " << (g.edgeExists(1, 2) ? "Yes" : "No") << "\n";
+    printComponents(g);
+
+    std::cout << "\n-- Deleting a Bridge Splits It --\n";
+    g.removeEdge(2, 3);
+    printComponents(g);
+
+    std::cout << "\n-- Last Update in a Batch Wins --\n";
+    g.applyBatch({{4, 5, 1, true}, {4, 5, 0, false}, {4, 5, 6, true}});
+    std::cout << "Edge 4 -> 5 exists? " << (g.edgeExists(4, 5) ? "Yes" : "No") << "\n";
+    printComponents(g);
+
+    std::cout << "\nEdge list:\n";
+    for (const Edge& e : g.getEdgeList())
+        std::cout << e.u << " -> " << e.v << " (w:" << e.weight << ")\n";
+
+    std::cout << "\n========== ALL TESTS COMPLETED SUCCESSFULLY ==========\n";
+    return 0;
+}
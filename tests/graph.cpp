@@ -49,17 +49,78 @@ void testPrint(Graph& g) {
     g.printAdjMatrix();
 }
 
+void testLazyMatrix(Graph& g) {
+    std::cout << "\n-- Lazy Adjacency Matrix --\n";
+    std::cout << "Matrix built initially? " << (g.hasAdjMatrix() ? "Yes" : "No") << "\n";
+    const auto& matrix = g.getAdjMatrix();
+    std::cout << "After getAdjMatrix(), weight(0->2): " << matrix[0][2] << "\n";
+    g.releaseAdjMatrix();
+    std::cout << "After releaseAdjMatrix(), built? " << (g.hasAdjMatrix() ? "Yes" : "No") << "\n";
+    std::cout << "Edge (2->4) exists? " << (g.edgeExists(2, 4) ? "Yes" : "No") << "\n";
+    std::cout << "Edge (4->2) exists? " << (g.edgeExists(4, 2) ? "Yes" : "No") << "\n";
+}
+
 void testTraversals(Graph& g) {
     std::cout << "\n-- BFS and DFS Traversals --\n";
     g.BFS(0);
     g.DFS(0);
 }
 
+// Stops the search as soon as the target is discovered and records the BFS tree.
+struct PathFinder : GraphVisitor<int, int> {
+    int target;
+    std::vector<int> parent;
+
+    PathFinder(int t, int n) : target(t), parent(n, -1) {}
+    VisitAction discoverVertex(int v) { return v == target ? VisitAction::Stop : VisitAction::Continue; }
+    void examineEdge(int u, int v, int) {
+        if (parent[v] == -1) parent[v] = u; // First edge to reach v is its BFS tree edge
+    }
+};
+
+// Prints discovery and finishing events (DFS parenthesis structure).
+struct EventLogger : GraphVisitor<int, int> {
+    void discoverVertex(int v) { std::cout << "(" << v << " "; }
+    void finishVertex(int v) { std::cout << v << ") "; }
+};
+
+void testVisitors(Graph& g) {
+    std::cout << "\n-- Visitor Traversals --\n";
+    std::cout << "DFS events from 0: ";
+    g.depthFirstVisit(0, EventLogger());
+    std::cout << "\n";
+
+    PathFinder finder(3, g.numVertices());
+    bool finished = g.breadthFirstVisit(0, finder);
+    std::cout << "BFS reached 3 early? " << (finished ? "No" : "Yes") << "; path: ";
+    std::vector<int> path;
+    for (int v = 3; v != 0; v = finder.parent[v]) path.push_back(v);
+    path.push_back(0);
+    for (auto it = path.rbegin(); it != path.rend(); ++it) std::cout << *it << " ";
+    std::cout << "\n";
+
+    // Skipping edges heavier than 2 restricts the search to light edges.
+    struct LightEdges : GraphVisitor<int, int> {
+        int reached = 0;
+        void discoverVertex(int) { ++reached; }
+        VisitAction examineEdge(int, int, int w) { return w > 2 ? VisitAction::Skip : VisitAction::Continue; }
+    } light;
+    g.breadthFirstVisit(0, light);
+    std::cout << "Vertices reachable from 0 over edges of weight <= 2: " << light.reached << "\n";
+}
+
 void testShortestPaths(Graph& g) {
     std::cout << "\n-- Dijkstra's Algorithm --\n";
     auto dijkstraDistances = g.dijkstra(0);
     printVector(dijkstraDistances, "Shortest distances from 0");
 
+    std::cout << "\n-- Dial's Bucket-Queue Dijkstra --\n";
+    auto dialDistances = g.dialDijkstra(0);
+    printVector(dialDistances, "Dial distances from 0");
+    std::cout << "Matches dijkstra? " << (dialDistances == dijkstraDistances ? "Yes" : "No") << "\n";
+    std::cout << "Second query reuses buckets, from 1: ";
+    printVector(g.dialDijkstra(1));
+
     std::cout << "\n-- Bellman-Ford Algorithm --\n";
     std::pair<std::vector<int>, bool> bellmanResult = g.bellmanFord(0);
     std::vector<int> bellmanDistances = bellmanResult.first;
@@ -67,6 +128,19 @@ void testShortestPaths(Graph& g) {
 
     printVector(bellmanDistances, "Bellman-Ford distances from 0");
     std::cout << "Negative cycle present? " << (hasNegCycle ? "Yes" : "No") << "\n";
+
+    std::cout << "\n-- SPFA and Parallel Bellman-Ford --\n";
+    auto spfaResult = g.spfa(0);
+    printVector(spfaResult.first, "SPFA distances from 0");
+    auto parallelResult = g.parallelBellmanFord(0);
+    printVector(parallelResult.first, "Parallel Bellman-Ford distances from 0");
+
+    Graph negative(3);
+    negative.addEdge(0, 1, 1);
+    negative.addEdge(1, 2, -3);
+    negative.addEdge(2, 1, 1);
+    std::cout << "Negative cycle (SPFA / parallel)? " << (negative.spfa(0).second ? "Yes" : "No")
+              << " / " << (negative.parallelBellmanFord(0).second ? "Yes" : "No") << "\n";
 }
 
 void testTopologicalSort(Graph& g) {
@@ -74,6 +148,30 @@ void testTopologicalSort(Graph& g) {
     auto topo = g.topologicalSort();
     if (!topo.empty()) printVector(topo, "Topological Order");
     else std::cout << "Cycle detected: Topological sort not possible.\n";
+
+    // Build DAG: weights are task durations; each level can run concurrently.
+    Graph build(7);
+    build.addEdge(0, 2, 3); // fetch -> configure
+    build.addEdge(1, 2, 1); // toolchain -> configure
+    build.addEdge(2, 3, 5); // configure -> compile lib
+    build.addEdge(2, 4, 2); // configure -> compile app
+    build.addEdge(3, 5, 4); // compile lib -> link
+    build.addEdge(4, 5, 4); // compile app -> link
+    build.addEdge(1, 6, 2); // toolchain -> docs
+    ThreadPool pool(4);
+    TopologicalLevels plan = build.topologicalLevels(pool);
+    for (int l = 0; l < plan.count(); ++l) {
+        std::cout << "Level " << l << ": ";
+        for (int i = plan.offsets[l]; i < plan.offsets[l + 1]; ++i) std::cout << plan.vertices[i] << " ";
+        std::cout << "\n";
+    }
+    printVector(plan.criticalPath, "Critical path");
+    std::cout << "Critical path length: " << plan.criticalLength << "\n";
+
+    build.addEdge(5, 2, 1); // link -> configure closes a cycle
+    TopologicalLevels blocked = build.topologicalLevels(pool);
+    std::cout << "With a cycle: acyclic? " << (blocked.acyclic ? "Yes" : "No") << ", levelled "
+              << blocked.vertices.size() << " of " << build.numVertices() << " vertices\n";
 }
 
 void testCycleDetection(Graph& g) {
@@ -86,19 +184,68 @@ void testConnectivity(Graph& g) {
     std::cout << "\n-- Connected Components --\n";
     std::cout << "Connected Components: " << g.countConnectedComponents() << "\n";
 
+    ThreadPool pool(4);
+    Graph islands(8); // {0, 1, 2}, {3, 4}, {5, 6, 7}; edges point one way only
+    int bridges[][2] = {{1, 0}, {2, 1}, {4, 3}, {7, 5}, {6, 7}};
+    for (auto& b : bridges) islands.addEdge(b[0], b[1], 1);
+    std::vector<int> labels = islands.connectedComponents(pool);
+    printVector(labels, "Parallel component labels (smallest vertex id)");
+    int roots = 0;
+    for (int v = 0; v < islands.numVertices(); ++v) roots += labels[v] == v;
+    std::cout << "Weakly connected components: " << roots << "\n";
+
     std::cout << "\n-- Bipartite Check --\n";
     std::cout << "Is graph bipartite? " << (g.isBipartite() ? "Yes" : "No") << "\n";
+
+    // Directed edges are followed both ways: the path 0 - 1 - 3 - 2 is bipartite
+    // even though no single edge direction connects all of it.
+    Graph chain(4);
+    chain.addEdge(0, 1, 1);
+    chain.addEdge(2, 3, 1);
+    chain.addEdge(3, 1, 1);
+    Bipartition parts = chain.bipartition();
+    std::cout << "Directed chain bipartite? " << (parts.bipartite ? "Yes" : "No") << ", sides: ";
+    for (char side : parts.side) std::cout << static_cast<int>(side) << " ";
+    std::cout << "\n";
 }
 
 void testMST(Graph& g) {
     std::cout << "\n-- Prim's MST --\n";
     std::cout << "Total MST Weight: " << g.primMST() << "\n";
+
+    std::cout << "\n-- Kruskal / Boruvka Spanning Forest --\n";
+    Graph forest(7); // Two components: {0..3} and {4, 5}, plus isolated 6
+    int undirected[][3] = {{0, 1, 4}, {1, 2, 1}, {2, 3, 2}, {0, 3, 3}, {0, 2, 5}, {4, 5, 7}};
+    for (auto& e : undirected) {
+        forest.addEdge(e[0], e[1], e[2]);
+        forest.addEdge(e[1], e[0], e[2]);
+    }
+    ThreadPool pool(4);
+    for (int mode = 0; mode < 2; ++mode) {
+        std::vector<Edge> edges = mode == 0 ? forest.kruskalMST(pool) : forest.boruvkaMST(pool);
+        int total = 0;
+        std::cout << (mode == 0 ? "Kruskal" : "Boruvka") << " edges: ";
+        for (const Edge& e : edges) {
+            std::cout << e.u << "-" << e.v << "(w:" << e.weight << ") ";
+            total += e.weight;
+        }
+        std::cout << "\nTotal forest weight: " << total << "\n";
+    }
 }
 
 void testAllPairsShortestPath(Graph& g) {
     std::cout << "\n-- Floyd-Warshall --\n";
     auto dist = g.floydWarshall();
     printMatrix(dist, "All-Pairs Shortest Paths");
+
+    std::cout << "\n-- Blocked Floyd-Warshall --\n";
+    auto flat = g.floydWarshallBlocked();
+    int n = static_cast<int>(dist.size());
+    bool same = true;
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+            same = same && flat[i * n + j] == dist[i][j];
+    std::cout << "Matches floydWarshall? " << (same ? "Yes" : "No") << "\n";
 }
 
 void testSCC(Graph& g) {
@@ -110,6 +257,12 @@ void testSCC(Graph& g) {
         for (int v : comp) std::cout << v << " ";
         std::cout << "\n";
     }
+
+    SCCResult flat = g.getSCCsFlat();
+    std::cout << "Flat SCC count: " << flat.count() << "\n";
+    printVector(flat.vertices, "Vertices grouped by SCC");
+    printVector(flat.offsets, "Component offsets");
+    printVector(flat.componentOf, "Component of each vertex");
 }
 
 void testEdgeVertexOps(Graph& g) {
@@ -133,6 +286,61 @@ void testTransposeAndUndirected(Graph& g) {
     g.printAdjList();
 }
 
+void testGenericTypes() {
+    std::cout << "\n-- Generic Vertex and Weight Types --\n";
+    // Float weights: fractional distances, unreachable vertices are +infinity.
+    BasicGraph<uint32_t, float> road(4);
+    road.addEdge(0, 1, 1.5f);
+    road.addEdge(1, 2, 0.25f);
+    road.addEdge(0, 2, 2.0f);
+    std::cout << "float dijkstra from 0: ";
+    for (float d : road.dijkstra(0)) std::cout << d << " ";
+    std::cout << "\n";
+
+    // 64-bit weights: sums that would overflow int.
+    BasicGraph<int, int64_t> wide(3);
+    wide.addEdge(0, 1, 3000000000LL);
+    wide.addEdge(1, 2, 3000000000LL);
+    std::cout << "int64 distance 0 -> 2: " << wide.dijkstra(0)[2] << "\n";
+
+    // No weights at all: every edge costs 1 and adjacency entries hold only the neighbor.
+    UnweightedGraph hops(5);
+    for (uint32_t v = 0; v + 1 < 5; ++v) hops.addEdge(v, v + 1);
+    hops.addEdge(0, 3);
+    std::cout << "Unweighted hop counts from 0: ";
+    for (int d : hops.dialDijkstra(0)) std::cout << d << " ";
+    std::cout << "\n";
+    hops.BFS(0);
+    std::cout << "Bytes per adjacency entry: Graph " << sizeof(Graph::Entry)
+              << ", UnweightedGraph " << sizeof(UnweightedGraph::Entry) << "\n";
+}
+
+void testTrianglesAndCores() {
+    std::cout << "\n-- Triangles and k-Cores --\n";
+    // Undirected: a 4-clique {0, 1, 2, 3}, a triangle {3, 4, 5} sharing vertex 3, and a tail 5 - 6.
+    Graph social(7);
+    int links[][2] = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {3, 4}, {4, 5}, {3, 5}, {5, 6}};
+    for (auto& l : links) social.addEdge(l[1], l[0], 1); // Unsorted insertion order
+    social.makeUndirected();
+    ThreadPool pool(4);
+    std::cout << "Sorted neighbors before? " << (social.hasSortedNeighbors() ? "Yes" : "No") << "\n";
+    std::cout << "Triangles: " << social.countTriangles(pool) << "\n";
+    std::cout << "Sorted neighbors after? " << (social.hasSortedNeighbors() ? "Yes" : "No") << "\n";
+
+    std::vector<int64_t> perVertex = social.triangleCounts(pool);
+    std::vector<double> clustering = social.clusteringCoefficients(pool);
+    std::vector<int> cores = social.coreNumbers();
+    for (int v = 0; v < social.numVertices(); ++v) {
+        std::cout << "Vertex " << v << ": triangles " << perVertex[v] << ", clustering "
+                  << clustering[v] << ", core " << cores[v] << "\n";
+    }
+
+    social.addEdge(3, 1, 1); // Parallel edge, inserted in sorted position
+    std::cout << "Neighbors of 3 after adding a parallel edge: ";
+    for (int v : social.getNeighbors(3)) std::cout << v << " ";
+    std::cout << "\nTriangles (parallel edges ignored): " << social.countTriangles(pool) << "\n";
+}
+
 // ------------------------- Main Driver ----------------------------
 
 int main() {
@@ -141,7 +349,9 @@ int main() {
     Graph g = initializeGraph();
 
     testPrint(g);
+    testLazyMatrix(g);
     testTraversals(g);
+    testVisitors(g);
     testShortestPaths(g);
     testTopologicalSort(g);
     testCycleDetection(g);
@@ -151,6 +361,8 @@ int main() {
     testSCC(g);
     testEdgeVertexOps(g);
     testTransposeAndUndirected(g);
+    testGenericTypes();
+    testTrianglesAndCores();
 
     std::cout << "\n========== ALL TESTS COMPLETED SUCCESSFULLY ==========\n";
     return 0;
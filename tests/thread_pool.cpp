@@ -0,0 +1,53 @@
+/**
+ * @author      Vaibhav Jindal
+ *              B.Tech CSE Core, VIT Bhopal
+ *
+ * @details     Modular, templated C++ library for
+ *              educational, research, and production use.
+ *
+ * 📦 Namespace: data_structures
+ * 📧 Contact  : jindalvaibhav63@gmail.com
+ */
+
+#include <iostream>
+#include "../data_structures/thread_pool.hpp"
+using namespace data_structures;
+
+int main() {
+    ThreadPool pool(4);
+    std::cout << "Pool size: " << pool.size() << "\n";
+
+    // Every worker runs the task exactly once.
+    std::vector<int> hits(pool.size(), 0);
+    pool.run([&](int worker) { hits[worker]++; });
+    std::cout << "Each worker ran once? "
+              << (std::count(hits.begin(), hits.end(), 1) == pool.size() ? "Yes" : "No") << "\n";
+
+    // parallelFor covers every index exactly once, across repeated jobs.
+    const int n = 100000;
+    std::vector<int> seen(n, 0);
+    for (int round = 0; round < 3; ++round) {
+        pool.parallelFor(0, n, [&](int64_t lo, int64_t hi, int) {
+            for (int64_t i = lo; i < hi; ++i) seen[i]++;
+        }, 1000);
+    }
+    std::cout << "All indices visited 3 times? "
+              << (std::count(seen.begin(), seen.end(), 3) == n ? "Yes" : "No") << "\n";
+
+    // Per-worker partial sums need no atomics.
+    std::vector<long long> partial(pool.size(), 0);
+    pool.parallelFor(1, n + 1, [&](int64_t lo, int64_t hi, int worker) {
+        for (int64_t i = lo; i < hi; ++i) partial[worker] += i;
+    });
+    long long total = 0;
+    for (long long p : partial) total += p;
+    std::cout << "Sum 1.." << n << " = " << total << "\n";
+
+    ThreadPool inlinePool(1);
+    int calls = 0;
+    inlinePool.parallelFor(0, 10, [&](int64_t lo, int64_t hi, int) { calls += static_cast<int>(hi - lo); });
+    std::cout << "Single-worker pool runs inline, indices: " << calls << "\n";
+
+    std::cout << "ALL TESTS COMPLETED....";
+    return 0;
+}